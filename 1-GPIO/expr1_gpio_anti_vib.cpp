@@ -3,27 +3,10 @@
  */
 #include <msp430.h>
 
-#include <stdint.h>
-typedef struct                   //以指针形式定义P8口的各个寄存器
-{
-  const volatile uint8_t* PxIN;     //定义一个不会被编译的无符号字符型变量
-  volatile uint8_t* PxOUT;
-  volatile uint8_t* PxDIR;
-  volatile uint8_t* PxREN;
-  volatile uint8_t* PxSEL;
-} GPIO_TypeDef;
-
-const GPIO_TypeDef GPIO4 =
-{ &P4IN, &P4OUT, &P4DIR, &P4REN, &P4SEL};
-
-const GPIO_TypeDef GPIO5 =
-{&P5IN, &P5OUT, &P5DIR, &P5REN, &P5SEL};
+#include "gpio_pin.h"
 
-const GPIO_TypeDef GPIO8 =
-{&P8IN, &P8OUT, &P8DIR, &P8REN, &P8SEL};
-
-const GPIO_TypeDef* LED_GPIO[5] = {&GPIO4, &GPIO4, &GPIO4, &GPIO5, &GPIO8};
-const uint8_t LED_PORT[5] = {BIT5, BIT6, BIT7, BIT7, BIT0};
+//LED1~LED5依次为P4.5、P4.6、P4.7、P5.7、P8.0，同一端口上的LED合并为一次读改写
+typedef GpioGroup<GpioPin<4, BIT5>, GpioPin<4, BIT6>, GpioPin<4, BIT7>, GpioPin<5, BIT7>, GpioPin<8, BIT0> > Leds;
 
 int main( void )
 {
@@ -38,9 +21,7 @@ int main( void )
 
   UCSCTL4 = SELA__XT1CLK + SELS__REFOCLK + SELM__REFOCLK; //时钟设为XT1，频率较低，方便软件延时
 
-  int i;
-  for(i=0;i<5;++i)
-    *LED_GPIO[i]->PxDIR |= LED_PORT[i]; //设置各LED灯所在端口为输出方向
+  Leds::output(); //设置各LED灯所在端口为输出方向
 
   P4REN |= 0x1F; //使能按键端口上的上下拉电阻
   P4OUT |= 0x1F; //上拉状态
@@ -67,24 +48,13 @@ int main( void )
           if(led_count < 5)
           {
             led_count++;
-            int i;
-            for(i = 0; i < 5; i++)
-            {
-              if(i < led_count)
-                *LED_GPIO[i]->PxOUT |= LED_PORT[i];
-              else
-                *LED_GPIO[i]->PxOUT &= ~LED_PORT[i];
-            }
+            Leds::write((1 << led_count) - 1); //点亮前led_count盏灯
           }
         }
         else if((btn_status & 0x10) == 0)  // 清零按键
         {
           led_count = 0;
-          int i;
-          for(i = 0; i < 5; i++)
-          {
-            *LED_GPIO[i]->PxOUT &= ~LED_PORT[i];
-          }
+          Leds::clear();
         }
         debounce_count++;  // 防止重复触发
       }
@@ -0,0 +1,154 @@
+/*
+ * gpio_pin.h
+ *
+ * 编译期确定端口和位的GPIO引脚，端口号与位掩码均为模板参数，
+ * 不再经过GPIO_TypeDef指针表，set/clear/toggle可直接编译为一条BIS.B/BIC.B/XOR.B
+ */
+#ifndef GPIO_PIN_H
+#define GPIO_PIN_H
+
+#include <msp430.h>
+#include <stdint.h>
+
+template <uint8_t N> struct GpioPort;
+
+//为每个端口特化出各寄存器的引用
+#define GPIO_PORT(N)                                           \
+  template <> struct GpioPort<N>                               \
+  {                                                            \
+    static const volatile uint8_t& in() { return P##N##IN; }   \
+    static volatile uint8_t& out() { return P##N##OUT; }       \
+    static volatile uint8_t& dir() { return P##N##DIR; }       \
+    static volatile uint8_t& ren() { return P##N##REN; }       \
+    static volatile uint8_t& sel() { return P##N##SEL; }       \
+  };
+
+GPIO_PORT(1)
+GPIO_PORT(2)
+GPIO_PORT(3)
+GPIO_PORT(4)
+GPIO_PORT(5)
+GPIO_PORT(6)
+GPIO_PORT(7)
+GPIO_PORT(8)
+GPIO_PORT(9)
+
+#undef GPIO_PORT
+
+//单个引脚，如GpioPin<4, BIT5>为P4.5
+template <uint8_t PORT, uint8_t MASK>
+struct GpioPin
+{
+  enum { port = PORT, mask = MASK };
+  typedef GpioPort<PORT> Port;
+
+  static void output() { Port::dir() |= MASK; }
+  static void input() { Port::dir() &= ~MASK; }
+  static void pullup() { Port::ren() |= MASK; Port::out() |= MASK; }
+  static void set() { Port::out() |= MASK; }
+  static void clear() { Port::out() &= ~MASK; }
+  static void toggle() { Port::out() ^= MASK; }
+  static void write(bool on) { if(on) set(); else clear(); }
+  static bool read() { return (Port::in() & MASK) != 0; }
+};
+
+//占位用的空引脚，不属于任何端口
+struct GpioNoPin
+{
+  enum { port = 0, mask = 0 };
+};
+
+//引脚组，最多8个引脚，同一端口上的引脚合并为一次读改写
+//sel参数的第i位对应第i个引脚
+template <class P0, class P1 = GpioNoPin, class P2 = GpioNoPin, class P3 = GpioNoPin,
+          class P4 = GpioNoPin, class P5 = GpioNoPin, class P6 = GpioNoPin, class P7 = GpioNoPin>
+class GpioGroup
+{
+  //组内属于端口N的所有引脚的掩码
+  template <uint8_t N> struct PortMask
+  {
+    enum
+    {
+      value = ((int)P0::port == N ? (int)P0::mask : 0) | ((int)P1::port == N ? (int)P1::mask : 0)
+            | ((int)P2::port == N ? (int)P2::mask : 0) | ((int)P3::port == N ? (int)P3::mask : 0)
+            | ((int)P4::port == N ? (int)P4::mask : 0) | ((int)P5::port == N ? (int)P5::mask : 0)
+            | ((int)P6::port == N ? (int)P6::mask : 0) | ((int)P7::port == N ? (int)P7::mask : 0)
+    };
+  };
+
+  //sel选中的、属于端口N的引脚的掩码，sel为常量时整个表达式在编译期求值
+  template <uint8_t N> static uint8_t selected(uint8_t sel)
+  {
+    uint8_t m = 0;
+    if(P0::port == N && (sel & 0x01)) m |= P0::mask;
+    if(P1::port == N && (sel & 0x02)) m |= P1::mask;
+    if(P2::port == N && (sel & 0x04)) m |= P2::mask;
+    if(P3::port == N && (sel & 0x08)) m |= P3::mask;
+    if(P4::port == N && (sel & 0x10)) m |= P4::mask;
+    if(P5::port == N && (sel & 0x20)) m |= P5::mask;
+    if(P6::port == N && (sel & 0x40)) m |= P6::mask;
+    if(P7::port == N && (sel & 0x80)) m |= P7::mask;
+    return m;
+  }
+
+  //以下各函数中，不含组内引脚的端口其条件为常量假，整段代码被编译器删除
+  template <uint8_t N> static void portOutput()
+  {
+    if(PortMask<N>::value != 0) GpioPort<N>::dir() |= PortMask<N>::value;
+  }
+  template <uint8_t N> static void portSet()
+  {
+    if(PortMask<N>::value != 0) GpioPort<N>::out() |= PortMask<N>::value;
+  }
+  template <uint8_t N> static void portClear()
+  {
+    if(PortMask<N>::value != 0) GpioPort<N>::out() &= ~PortMask<N>::value;
+  }
+  template <uint8_t N> static void portWrite(uint8_t sel)
+  {
+    if(PortMask<N>::value != 0)
+      GpioPort<N>::out() = (GpioPort<N>::out() & ~PortMask<N>::value) | selected<N>(sel);
+  }
+  template <uint8_t N> static void portToggle(uint8_t sel)
+  {
+    if(PortMask<N>::value != 0) GpioPort<N>::out() ^= selected<N>(sel);
+  }
+
+public:
+  //将组内所有引脚设为输出
+  static void output()
+  {
+    portOutput<1>(); portOutput<2>(); portOutput<3>(); portOutput<4>(); portOutput<5>();
+    portOutput<6>(); portOutput<7>(); portOutput<8>(); portOutput<9>();
+  }
+
+  //组内所有引脚置高
+  static void set()
+  {
+    portSet<1>(); portSet<2>(); portSet<3>(); portSet<4>(); portSet<5>();
+    portSet<6>(); portSet<7>(); portSet<8>(); portSet<9>();
+  }
+
+  //组内所有引脚置低
+  static void clear()
+  {
+    portClear<1>(); portClear<2>(); portClear<3>(); portClear<4>(); portClear<5>();
+    portClear<6>(); portClear<7>(); portClear<8>(); portClear<9>();
+  }
+
+  //sel中为1的引脚置高，其余置低
+  static void write(uint8_t sel)
+  {
+    portWrite<1>(sel); portWrite<2>(sel); portWrite<3>(sel); portWrite<4>(sel); portWrite<5>(sel);
+    portWrite<6>(sel); portWrite<7>(sel); portWrite<8>(sel); portWrite<9>(sel);
+  }
+
+  //翻转sel中为1的引脚
+  static void toggle(uint8_t sel)
+  {
+    portToggle<1>(sel); portToggle<2>(sel); portToggle<3>(sel); portToggle<4>(sel); portToggle<5>(sel);
+    portToggle<6>(sel); portToggle<7>(sel); portToggle<8>(sel); portToggle<9>(sel);
+  }
+};
+
+#endif
@@ -7,23 +7,16 @@
 #define SMCLK_FREQ 1000000
 #define ACLK_FREQ 32760
 
-typedef struct // 以指针形式定义P8口的各个寄存器
-{
-    const volatile uint8_t* PxIN; // 定义一个不会被编译的无符号字符型变量
-    volatile uint8_t* PxOUT;
-    volatile uint8_t* PxDIR;
-    volatile uint8_t* PxREN;
-    volatile uint8_t* PxSEL;
-} GPIO_TypeDef;
+// LED1~LED5依次为P4.5、P4.6、P4.7、P5.7、P8.0
+// 端口与位在编译期确定，按端口合并后每次刷新对每个端口只做一次读改写，不再经过指针表循环
+#define LED_P4 (BIT5 + BIT6 + BIT7)
+#define LED_P5 BIT7
+#define LED_P8 BIT0
 
-const GPIO_TypeDef GPIO4 = { &P4IN, &P4OUT, &P4DIR, &P4REN, &P4SEL };
-
-const GPIO_TypeDef GPIO5 = { &P5IN, &P5OUT, &P5DIR, &P5REN, &P5SEL };
-
-const GPIO_TypeDef GPIO8 = { &P8IN, &P8OUT, &P8DIR, &P8REN, &P8SEL };
-
-const GPIO_TypeDef* LED_GPIO[5] = { &GPIO4, &GPIO4, &GPIO4, &GPIO5, &GPIO8 };
-const uint8_t LED_PORT[5] = { BIT5, BIT6, BIT7, BIT7, BIT0 };
+// 点亮前n盏灯时各端口应置高的位，以n为下标
+const uint8_t LED_P4_MASK[6] = { 0, BIT5, BIT5 + BIT6, LED_P4, LED_P4, LED_P4 };
+const uint8_t LED_P5_MASK[6] = { 0, 0, 0, 0, LED_P5, LED_P5 };
+const uint8_t LED_P8_MASK[6] = { 0, 0, 0, 0, 0, LED_P8 };
 
 uint8_t led_count = 0; // 当前点亮的LED数量
 
@@ -33,9 +26,9 @@ void toggle_led(uint8_t led_count);
 void main(void) {
     WDTCTL = WDTPW + WDTHOLD; // 关闭看门狗
 
-    int i;
-    for (i = 0; i < 5; ++i)
-        *LED_GPIO[i]->PxDIR |= LED_PORT[i]; // 设置各LED灯所在端口为输出方向
+    P4DIR |= LED_P4; // 设置各LED灯所在端口为输出方向
+    P5DIR |= LED_P5;
+    P8DIR |= LED_P8;
 
     TA0CTL |= MC_1 + TASSEL_1 + TACLR;
     // 时钟为SMCLK,比较模式，开始时清零计数器
@@ -55,19 +48,16 @@ void main(void) {
 }
 
 void refresh_led(uint8_t led_count) {
-    int i;
-    for (i = 0; i < 5; i++) {
-        if (i < led_count)
-            *LED_GPIO[i]->PxOUT |= LED_PORT[i];
-        else
-            *LED_GPIO[i]->PxOUT &= ~LED_PORT[i];
-    }
+    P4OUT = (P4OUT & ~LED_P4) | LED_P4_MASK[led_count];
+    P5OUT = (P5OUT & ~LED_P5) | LED_P5_MASK[led_count];
+    P8OUT = (P8OUT & ~LED_P8) | LED_P8_MASK[led_count];
 }
 
+// 每个端口一条XOR.B，中断中无循环
 void toggle_led(uint8_t led_count) {
-    int i;
-    for (i = 0; i < led_count; i++)
-        *LED_GPIO[i]->PxOUT ^= LED_PORT[i];
+    P4OUT ^= LED_P4_MASK[led_count];
+    P5OUT ^= LED_P5_MASK[led_count];
+    P8OUT ^= LED_P8_MASK[led_count];
 }
 
 #pragma vector = TIMER0_A0_VECTOR
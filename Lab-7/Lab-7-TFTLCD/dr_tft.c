@@ -18,12 +18,139 @@
 #define 	LCD_SCI_SET		P8OUT |= 0x20
 #define 	LCD_SCI_CLR		P8OUT &=~0x20
 
-#define tft_send_and_wait(x, y) tft_SendCmd(x, y);__delay_cycles(MCLK_FREQ / 1000);
-#define tft_send_and_wait2(x, y, z) tft_SendCmd(x, y);__delay_cycles(MCLK_FREQ / 1000 * z);
+//ʼָһĴֵдĵȴʱ(λ0.1ms)
+typedef struct
+{
+  uint16_t reg;
+  uint16_t value;
+  uint8_t wait;
+} TftInitStep;
+
+static const TftInitStep tft_init_table[] =
+{
+  { TFTREG_SOFT_RESET, 0x0001, 10 }, //λ
+  { 0x0100, 0x0000, 10 }, //power supply setupԴĴÿдȴ1ms
+  { 0x0101, 0x0000, 10 },
+  { 0x0102, 0x3110, 10 },
+  { 0x0103, 0xe200, 10 },
+  { 0x0110, 0x009d, 10 },
+  { 0x0111, 0x0022, 10 },
+  { 0x0100, 0x0120, 11 },
+  { 0x0100, 0x3120, 15 },
+  //Display control
+  { 0x0001, 0x0000, 0 },
+  { 0x0002, 0x0000, 0 },
+  { 0x0003, 0x1238, 0 },
+  { 0x0006, 0x0000, 0 },
+  { 0x0007, 0x0101, 0 },
+  { 0x0008, 0x0808, 0 },
+  { 0x0009, 0x0000, 0 },
+  { 0x000b, 0x0000, 0 },
+  { 0x000c, 0x0100, 0 },
+  { 0x000d, 0x0018, 0 },
+  //LTPS control settings
+  { 0x0012, 0x0000, 0 },
+  { 0x0013, 0x0000, 0 },
+  { 0x0018, 0x0000, 0 },
+  { 0x0019, 0x0000, 0 },
+  { 0x0203, 0x0000, 0 },
+  { 0x0204, 0x0000, 0 },
+  { 0x0210, 0x0000, 0 },
+  { 0x0211, 0x00ef, 0 },
+  { 0x0212, 0x0000, 0 },
+  { 0x0213, 0x013f, 0 },
+  { 0x0214, 0x0000, 0 },
+  { 0x0215, 0x0000, 0 },
+  { 0x0216, 0x0000, 0 },
+  { 0x0217, 0x0000, 0 },
+  //Gray scale settings
+  { 0x0300, 0x5343, 0 },
+  { 0x0301, 0x1021, 0 },
+  { 0x0302, 0x0003, 0 },
+  { 0x0303, 0x0011, 0 },
+  { 0x0304, 0x050a, 0 },
+  { 0x0305, 0x4342, 0 },
+  { 0x0306, 0x1100, 0 },
+  { 0x0307, 0x0003, 0 },
+  { 0x0308, 0x1201, 0 },
+  { 0x0309, 0x050a, 0 },
+  //RAM access settings
+  { 0x0400, 0x4027, 0 },
+  { 0x0401, 0x0000, 0 },
+  { 0x0402, 0x0000, 0 }, //First screen drive position (1)
+  { 0x0403, 0x013f, 0 }, //First screen drive position (2)
+  { 0x0404, 0x0000, 0 },
+  { 0x0200, 0x0000, 0 },
+  { 0x0201, 0x0000, 0 },
+  { 0x0100, 0x7120, 10 },
+  { 0x0007, 0x0103, 11 },
+  { 0x0007, 0x0113, 0 },
+};
+
+#if TFT_USE_TIMING
+static uint16_t tft_ReadTick();
+static uint16_t init_ticks = 0; //initTFTʱ(TB0ֵ)
+
+//ͳƣ뿪ʼʱ(TB0ֵ)
+static uint32_t pixel_count = 0;
+static uint16_t pixel_start_tick = 0;
+static uint32_t last_pixel_count = 0;
+static uint16_t last_pixel_ticks = 0;
+#define TFT_COUNT_PIXELS(n) (pixel_count += (n))
+#else
+#define TFT_COUNT_PIXELS(n)
+#endif
+
+//1λչÿֽչΪ4صĴֽڣλΪ1ȡǰɫ
+static uint8_t mono_lut[16][8];
+static uint16_t mono_fg = 0, mono_bg = 0;
+static uint8_t mono_valid = 0;
+
+//2λҶص4ɫ0Ϊɫ3Ϊǰɫֽ
+static uint8_t shade_lut[4][2];
+static uint16_t shade_fg = 0, shade_bg = 0;
+static uint8_t shade_valid = 0;
+
+#if TFT_SHADOW_REGS
+#define TFT_SHADOW_BASE TFTREG_RAM_YADDR //0x200
+#define TFT_SHADOW_COUNT 24 //0x200~0x217
+#define TFT_SHADOW_RAM_ADDR 0x0003 //RAM_YADDRRAM_XADDRӰӸеλ
+
+static uint16_t shadow_value[TFT_SHADOW_COUNT];
+static uint32_t shadow_valid = 0; //ÿλӦһĴӰӸǷЧ
+static uint32_t cmd_issued = 0;
+static uint32_t cmd_suppressed = 0;
+#endif
+
+#if TFT_USE_DMA
+#define TFT_DMA_TRIGGER DMA0TSEL_23 //UCB1TXIFG
+#define TFT_DMA_MAX_CHUNK 0xFFFE //DMA0SZΪ16λżֽڷֶ
+
+static volatile uint8_t dma_busy = 0;
+static const uint8_t* dma_src; //һεԴַ
+static uint32_t dma_remain; //ʣֽ
+static uint16_t dma_ctl; //ÿʹõDMA0CTL
+static uint16_t dma_chunk_limit; //ÿֽ
+static uint8_t dma_advance; //ÿνԴַǷ
+static tft_DmaCallback dma_callback;
+static uint8_t dma_pattern[TFT_DMA_FILL_PIXELS * 2]; //RGB565ɫͼ
+static uint16_t dma_pattern_color; //ͼеǰɫ
+static uint8_t dma_pattern_valid = 0;
+#endif
 
 //ʼTFT
 void initTFT()
 {
+  uint16_t i;
+  uint8_t wait;
+#if TFT_USE_TIMING
+  uint16_t init_start;
+
+  //TB0ACLKͳƳʼʱٶ
+  TB0CTL = TBSSEL__ACLK + MC__CONTINUOUS + TBCLR;
+  init_start = tft_ReadTick();
+#endif
+
   //ʼRSCS˿
   P5DIR |= BIT0 + BIT2;
   P1DIR |= BIT1;
@@ -49,75 +176,24 @@ void initTFT()
   P8SEL |= BIT4 + BIT5 + BIT6;
   P8DIR |= BIT4 + BIT5;
   UCB1CTL1 &= ~UCSWRST;
+
+#if TFT_USE_DMA
+  //DMAͨ0UCB1TXIFG
+  DMACTL0 = (DMACTL0 & ~0x001F) | TFT_DMA_TRIGGER;
+  DMACTL4 = DMARMWDIS; //CPUдִָڼ䲻DMA
+#endif
   
-  //дʼTFTLCDָ
-  tft_send_and_wait(TFTREG_SOFT_RESET, 0x0001); //λ
-  tft_send_and_wait( 0x100, 0x0000 ); /*power supply setup*/
-  tft_send_and_wait( 0x101, 0x0000 );
-  tft_send_and_wait( 0x102, 0x3110 );
-  tft_send_and_wait( 0x103, 0xe200 );
-  tft_send_and_wait( 0x110, 0x009d );
-  tft_send_and_wait( 0x111, 0x0022 );
-  tft_send_and_wait( 0x100, 0x0120 );
-  __delay_cycles(2000);;
-
-  tft_send_and_wait( 0x100, 0x3120 );
-  __delay_cycles(10000);;
-  	/* Display control */
-  tft_send_and_wait( 0x001, 0x0000 );
-  tft_send_and_wait( 0x002, 0x0000 );
-  tft_send_and_wait( 0x003, 0x1238 );
-  tft_send_and_wait( 0x006, 0x0000 );
-  tft_send_and_wait( 0x007, 0x0101 );
-  tft_send_and_wait( 0x008, 0x0808 );
-  tft_send_and_wait( 0x009, 0x0000 );
-  tft_send_and_wait( 0x00b, 0x0000 );
-  tft_send_and_wait( 0x00c, 0x0100 );
-  tft_send_and_wait( 0x00d, 0x0018 );
-  	/* LTPS control settings */
-  tft_send_and_wait( 0x012, 0x0000 );
-  tft_send_and_wait( 0x013, 0x0000 );
-  tft_send_and_wait( 0x018, 0x0000 );
-  tft_send_and_wait( 0x019, 0x0000 );
-
-  tft_send_and_wait( 0x203, 0x0000 );
-  tft_send_and_wait( 0x204, 0x0000 );
-
-  tft_send_and_wait( 0x210, 0x0000 );
-  tft_send_and_wait( 0x211, 0x00ef );
-  tft_send_and_wait( 0x212, 0x0000 );
-  tft_send_and_wait( 0x213, 0x013f );
-  tft_send_and_wait( 0x214, 0x0000 );
-  tft_send_and_wait( 0x215, 0x0000 );
-  tft_send_and_wait( 0x216, 0x0000 );
-  tft_send_and_wait( 0x217, 0x0000 );
-
-  	// Gray scale settings
-  tft_send_and_wait( 0x300, 0x5343);
-  tft_send_and_wait( 0x301, 0x1021);
-  tft_send_and_wait( 0x302, 0x0003);
-  tft_send_and_wait( 0x303, 0x0011);
-  tft_send_and_wait( 0x304, 0x050a);
-  tft_send_and_wait( 0x305, 0x4342);
-  tft_send_and_wait( 0x306, 0x1100);
-  tft_send_and_wait( 0x307, 0x0003);
-  tft_send_and_wait( 0x308, 0x1201);
-  tft_send_and_wait( 0x309, 0x050a);
-
-  	/* RAM access settings */
-  tft_send_and_wait( 0x400, 0x4027 );
-  tft_send_and_wait( 0x401, 0x0000 );
-  tft_send_and_wait( 0x402, 0x0000 );	/* First screen drive position (1) */
-  tft_send_and_wait( 0x403, 0x013f );	/* First screen drive position (2) */
-  tft_send_and_wait( 0x404, 0x0000 );
-
-  tft_send_and_wait( 0x200, 0x0000 );
-  tft_send_and_wait( 0x201, 0x0000 );
-
-  tft_send_and_wait( 0x100, 0x7120 );
-  tft_send_and_wait( 0x007, 0x0103 );
-  __delay_cycles(2000);
-  tft_send_and_wait( 0x007, 0x0113 );
+  //дʼָֻϵȲҪȴ
+  for(i = 0; i < sizeof(tft_init_table) / sizeof(tft_init_table[0]); i++)
+  {
+    tft_SendCmd(tft_init_table[i].reg, tft_init_table[i].value);
+    for(wait = tft_init_table[i].wait; wait > 0; wait--)
+      __delay_cycles(MCLK_FREQ / 10000);
+  }
+
+#if TFT_USE_TIMING
+  init_ticks = tft_ReadTick() - init_start;
+#endif
 }
 
 void tft_AddTxData(uint16_t val)
@@ -132,6 +208,10 @@ void tft_AddTxData(uint16_t val)
 //TFTһַǷͳɹ
 int tft_SendIndex(uint16_t val)
 {
+#if TFT_SHADOW_REGS
+  if(val == TFTREG_RAM_ACCESS) //дغRAMַԭдĵַЧ
+    shadow_valid &= ~(uint32_t)TFT_SHADOW_RAM_ADDR;
+#endif
   LCD_CS_CLR;
   LCD_RS_CLR;
   tft_AddTxData(val);
@@ -152,7 +232,398 @@ int tft_SendData(uint16_t val)
 //TFTļĴregdataǷͳɹ
 int tft_SendCmd(uint16_t reg, uint16_t data)
 {
+#if TFT_SHADOW_REGS
+  uint16_t idx = reg - TFT_SHADOW_BASE;
+  if(idx < TFT_SHADOW_COUNT)
+  {
+    uint32_t bit = (uint32_t)1 << idx;
+    if((shadow_valid & bit) && shadow_value[idx] == data)
+    {
+      cmd_suppressed++;
+      return 1;
+    }
+    shadow_value[idx] = data;
+    shadow_valid |= bit;
+  }
+  else if(reg == TFTREG_SOFT_RESET)
+    shadow_valid = 0;
+  cmd_issued++;
+#endif
   tft_SendIndex(reg);
   tft_SendData(data);
   return 1;
 }
+
+#if TFT_SHADOW_REGS
+void tft_GetCmdStat(uint32_t* issued, uint32_t* suppressed)
+{
+  if(issued)
+    *issued = cmd_issued;
+  if(suppressed)
+    *suppressed = cmd_suppressed;
+}
+
+void tft_ResetCmdStat()
+{
+  cmd_issued = 0;
+  cmd_suppressed = 0;
+}
+
+void tft_InvalidateShadow()
+{
+  shadow_valid = 0;
+}
+#endif
+
+//ʾڲRAMдַ
+void tft_SetWindow(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY)
+{
+  tft_SendCmd(TFTREG_WIN_MINX, startX);
+  tft_SendCmd(TFTREG_WIN_MINY, startY);
+  tft_SendCmd(TFTREG_WIN_MAXX, endX);
+  tft_SendCmd(TFTREG_WIN_MAXY, endY);
+  tft_SendCmd(TFTREG_RAM_XADDR, startX);
+  tft_SendCmd(TFTREG_RAM_YADDR, startY);
+  tft_SendIndex(TFTREG_RAM_ACCESS);
+}
+
+#if TFT_USE_TIMING
+//һinitTFTĺʱλΪ΢
+uint32_t tft_InitTime()
+{
+  return (uint32_t)init_ticks * 1000000 / ACLK_FREQ;
+}
+
+//TB0MCLK첽ֵͬſ
+static uint16_t tft_ReadTick()
+{
+  uint16_t t;
+  do
+  {
+    t = TB0R;
+  } while(t != TB0R);
+  return t;
+}
+#endif
+
+//ʼһд
+void tft_BeginPixels()
+{
+  LCD_CS_CLR;
+  LCD_RS_SET; //ڼRSΪ
+#if TFT_USE_TIMING
+  pixel_count = 0;
+  pixel_start_tick = tft_ReadTick();
+#endif
+}
+
+//дһأȴλĴſ
+void tft_PushPixel(uint16_t color)
+{
+  while(!(UCB1IFG & UCTXIFG)); //ȴͻ
+  UCB1TXBUF = color >> 8; //͸λ
+  while(!(UCB1IFG & UCTXIFG)); //ȴͻ
+  UCB1TXBUF = color & 0xFF; //͵λ
+  TFT_COUNT_PIXELS(1);
+}
+
+//дcount
+void tft_PushPixels(const uint16_t* colors, uint16_t count)
+{
+  uint16_t i;
+  for(i=0;i<count;i++)
+  {
+    uint16_t color = colors[i];
+    while(!(UCB1IFG & UCTXIFG));
+    UCB1TXBUF = color >> 8;
+    while(!(UCB1IFG & UCTXIFG));
+    UCB1TXBUF = color & 0xFF;
+  }
+  TFT_COUNT_PIXELS(count);
+}
+
+//дcountͬɫ
+void tft_PushPixelRepeat(uint16_t color, uint32_t count)
+{
+  uint8_t high = color >> 8;
+  uint8_t low = color & 0xFF;
+  uint32_t i;
+  for(i=0;i<count;i++)
+  {
+    while(!(UCB1IFG & UCTXIFG));
+    UCB1TXBUF = high;
+    while(!(UCB1IFG & UCTXIFG));
+    UCB1TXBUF = low;
+  }
+  TFT_COUNT_PIXELS(count);
+}
+
+//дcountԤתõ
+void tft_PushPixelBytes(const uint8_t* data, uint32_t count)
+{
+  uint32_t i;
+  for(i=0;i<count;i++)
+  {
+    while(!(UCB1IFG & UCTXIFG));
+    UCB1TXBUF = *data++;
+    while(!(UCB1IFG & UCTXIFG));
+    UCB1TXBUF = *data++;
+  }
+  TFT_COUNT_PIXELS(count);
+}
+
+//1λǰɫ뱳ɫ뵱ǰչͬʱؽ
+void tft_SetMonoColors(uint16_t fRGB, uint16_t bRGB)
+{
+  uint8_t n, i;
+  if(mono_valid && mono_fg == fRGB && mono_bg == bRGB)
+    return;
+  for(n=0;n<16;n++)
+  {
+    for(i=0;i<4;i++)
+    {
+      uint16_t color = (n & (0x08 >> i)) ? fRGB : bRGB;
+      mono_lut[n][i * 2] = color >> 8;
+      mono_lut[n][i * 2 + 1] = color & 0xFF;
+    }
+  }
+  mono_fg = fRGB;
+  mono_bg = bRGB;
+  mono_valid = 1;
+}
+
+//չһֽڵǰcount(1~4)
+static inline void tft_PushMonoNibble(const uint8_t* p, uint8_t count)
+{
+  count *= 2;
+  do
+  {
+    while(!(UCB1IFG & UCTXIFG));
+    UCB1TXBUF = *p++;
+  } while(--count);
+}
+
+//bits[0]ĵshiftλ(0Ϊλ)ʼλǰcount1λأÿȡ8λλж
+void tft_PushMonoBits(const uint8_t* bits, uint8_t shift, uint16_t count)
+{
+  TFT_COUNT_PIXELS(count);
+  while(count >= 8)
+  {
+    uint8_t b = *bits++;
+    if(shift)
+      b = (b << shift) | (*bits >> (8 - shift));
+    tft_PushMonoNibble(mono_lut[b >> 4], 4);
+    tft_PushMonoNibble(mono_lut[b & 0x0F], 4);
+    count -= 8;
+  }
+  if(count)
+  {
+    uint8_t b = *bits << shift;
+    if(shift + count > 8) //µλһֽ
+      b |= bits[1] >> (8 - shift);
+    tft_PushMonoNibble(mono_lut[b >> 4], count > 4 ? 4 : count);
+    if(count > 4)
+      tft_PushMonoNibble(mono_lut[b & 0x0F], count - 4);
+  }
+}
+
+//2λҶصǰɫ뱳ɫԤ4ɫɫδʱ
+void tft_SetShadeColors(uint16_t fRGB, uint16_t bRGB)
+{
+  uint8_t k;
+  if(shade_valid && shade_fg == fRGB && shade_bg == bRGB)
+    return;
+  for(k=0;k<4;k++)
+  {
+    //RGB565ֱk/3Բֵ
+    uint16_t r = ((fRGB >> 11) * k + (bRGB >> 11) * (3 - k) + 1) / 3;
+    uint16_t g = (((fRGB >> 5) & 0x3F) * k + ((bRGB >> 5) & 0x3F) * (3 - k) + 1) / 3;
+    uint16_t b = ((fRGB & 0x1F) * k + (bRGB & 0x1F) * (3 - k) + 1) / 3;
+    uint16_t color = (r << 11) | (g << 5) | b;
+    shade_lut[k][0] = color >> 8;
+    shade_lut[k][1] = color & 0xFF;
+  }
+  shade_fg = fRGB;
+  shade_bg = bRGB;
+  shade_valid = 1;
+}
+
+//bits[0]ĵshiftλ(0246)ʼλǰcount2λأÿزһ
+void tft_PushShadeBits(const uint8_t* bits, uint8_t shift, uint16_t count)
+{
+  uint8_t b, left;
+  if(count == 0)
+    return;
+  b = *bits++ << shift;
+  left = (8 - shift) >> 1; //ǰֽʣ
+  TFT_COUNT_PIXELS(count);
+  while(count--)
+  {
+    const uint8_t* p;
+    if(left == 0)
+    {
+      b = *bits++;
+      left = 4;
+    }
+    p = shade_lut[b >> 6];
+    while(!(UCB1IFG & UCTXIFG));
+    UCB1TXBUF = p[0];
+    while(!(UCB1IFG & UCTXIFG));
+    UCB1TXBUF = p[1];
+    b <<= 2;
+    left--;
+  }
+}
+
+//д
+void tft_EndPixels()
+{
+  while(UCB1STAT & UCBUSY); //ȴһλʵͳ
+  LCD_CS_SET;
+#if TFT_USE_TIMING
+  last_pixel_ticks = tft_ReadTick() - pixel_start_tick;
+  last_pixel_count = pixel_count;
+#endif
+}
+
+#if TFT_USE_TIMING
+
+//һʵдٶ(/)μʱ2s(ACLKTB0)ʱЧ
+uint32_t tft_PixelsPerSecond()
+{
+  if(last_pixel_ticks == 0)
+    return 0;
+  return (uint32_t)((uint64_t)last_pixel_count * ACLK_FREQ / last_pixel_ticks);
+}
+#endif
+
+#if TFT_USE_DMA
+//һDMA䣬ȫʱ1
+static int tft_DmaNext()
+{
+  uint16_t size;
+  if(dma_remain == 0)
+  {
+    dma_busy = 0;
+    if(dma_callback)
+      dma_callback();
+    return 1;
+  }
+
+  size = dma_remain > dma_chunk_limit ? dma_chunk_limit : dma_remain;
+  dma_remain -= size;
+
+  DMA0CTL = 0;
+  __data16_write_addr((unsigned short)&DMA0SA, (unsigned long)dma_src);
+  __data16_write_addr((unsigned short)&DMA0DA, (unsigned long)&UCB1TXBUF);
+  DMA0SZ = size;
+  if(dma_advance)
+    dma_src += size; //һνӱ
+  DMA0CTL = dma_ctl;
+
+  //DMAUCTXIFGشȷͻպΪһ
+  while(!(UCB1IFG & UCTXIFG));
+  UCB1IFG &= ~UCTXIFG;
+  UCB1IFG |= UCTXIFG;
+  return 0;
+}
+
+//src_incrΪԴַĵʽadvanceΪ0ʱÿζsrc¿ʼ
+static void tft_DmaStart(const uint8_t* src,
+                         uint32_t bytes,
+                         uint16_t src_incr,
+                         uint16_t limit,
+                         uint8_t advance,
+                         tft_DmaCallback callback)
+{
+  dma_src = src;
+  dma_remain = bytes;
+  dma_ctl = DMADT_0 + src_incr + DMADSTINCR_0 + DMASRCBYTE + DMADSTBYTE + DMAIE + DMAEN;
+  dma_chunk_limit = limit;
+  dma_advance = advance;
+  dma_callback = callback;
+  dma_busy = 1;
+  TFT_COUNT_PIXELS(bytes / 2);
+  tft_DmaNext();
+}
+
+//DMAдcountͬɫ
+void tft_DmaFill(uint16_t color, uint32_t count, tft_DmaCallback callback)
+{
+  uint8_t high = color >> 8;
+  uint8_t low = color & 0xFF;
+  uint16_t i;
+
+  if(high == low) //ߵ̶ֽͬԴַÿοɷԼ32k
+  {
+    dma_pattern[0] = high;
+    dma_pattern_valid = 0;
+    tft_DmaStart(dma_pattern, count * 2, DMASRCINCR_0, TFT_DMA_MAX_CHUNK, 0, callback);
+    return;
+  }
+
+  if(!dma_pattern_valid || dma_pattern_color != color) //ɫδʱϴεͼ
+  {
+    for(i=0;i<sizeof(dma_pattern);i+=2)
+    {
+      dma_pattern[i] = high;
+      dma_pattern[i + 1] = low;
+    }
+    dma_pattern_color = color;
+    dma_pattern_valid = 1;
+  }
+  tft_DmaStart(dma_pattern, count * 2, DMASRCINCR_3, sizeof(dma_pattern), 0, callback);
+}
+
+//DMAдcountԤתõ
+void tft_DmaWrite(const uint8_t* data, uint32_t count, tft_DmaCallback callback)
+{
+  tft_DmaStart(data, count * 2, DMASRCINCR_3, TFT_DMA_MAX_CHUNK, 1, callback);
+}
+
+int tft_DmaBusy()
+{
+  return dma_busy;
+}
+
+//ȴDMA
+void tft_DmaWait()
+{
+  if(__get_SR_register() & GIE)
+  {
+    __disable_interrupt(); //־͹֮䲻ܱDMAжϲ
+    while(dma_busy)
+    {
+      __bis_SR_register(LPM0_bits + GIE); //DMAжϻ
+      __disable_interrupt();
+    }
+    __enable_interrupt();
+  }
+  else
+  {
+    //жϹرʱѯDMA־CPU
+    while(dma_busy)
+    {
+      if(DMA0CTL & DMAIFG)
+      {
+        DMA0CTL &= ~DMAIFG;
+        tft_DmaNext();
+      }
+    }
+  }
+}
+
+#pragma vector = DMA_VECTOR
+__interrupt void tft_DmaIsr(void)
+{
+  switch(__even_in_range(DMAIV, 16))
+  {
+    case 2: //DMA0IFG
+      if(tft_DmaNext())
+        __bic_SR_register_on_exit(LPM0_bits); //ɣtft_DmaWait
+      break;
+    default:
+      break;
+  }
+}
+#endif
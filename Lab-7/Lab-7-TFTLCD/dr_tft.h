@@ -11,8 +11,38 @@
     #define SMCLK_FREQ 20000000
 #endif
 
+#ifndef ACLK_FREQ
+    #define ACLK_FREQ 32768
+#endif
+
 #define SPI_FREQ 10000000
 
+//是否使用DMA通道0(由UCB1TXIFG触发)发送大块像素数据，DMA中断由驱动占用
+#ifndef TFT_USE_DMA
+    #define TFT_USE_DMA 1
+#endif
+
+//是否占用定时器TB0(ACLK连续计数)统计initTFT耗时与像素流速度，initTFT会清零并重新配置TB0
+//应用程序自己使用TB0时须定义为0，此时不提供tft_InitTime与tft_PixelsPerSecond
+#ifndef TFT_USE_TIMING
+    #define TFT_USE_TIMING 1
+#endif
+
+//像素数少于此值时直接由CPU发送，DMA的启动开销不划算
+#define TFT_DMA_MIN_PIXELS 32
+
+//tft_DmaFill在颜色高低字节不同时循环发送的颜色图样长度(像素)，占用2倍字节的RAM
+//每发送完一遍图样进一次DMA中断重新启动，整屏填充约需76800 / TFT_DMA_FILL_PIXELS次中断
+//不用重复块传输模式：最后一块结束后下一次触发在一个SPI字节时间内到来，短于中断响应时间，无法及时停止
+#ifndef TFT_DMA_FILL_PIXELS
+    #define TFT_DMA_FILL_PIXELS 512
+#endif
+
+//是否为0x200~0x217(RAM地址与窗口)寄存器保留影子副本，跳过写入值未变化的tft_SendCmd
+#ifndef TFT_SHADOW_REGS
+    #define TFT_SHADOW_REGS 1
+#endif
+
 #define TFT_XSIZE 240
 #define TFT_YSIZE 320
 
@@ -39,8 +69,85 @@ int tft_SendIndex(uint16_t val);
 int tft_SendData(uint16_t val);
 
 //向TFT屏的寄存器reg发送数据data，返回是否发送成功
+//启用TFT_SHADOW_REGS时，若寄存器已是该值则不实际发送
 int tft_SendCmd(uint16_t reg, uint16_t data);
 
+#if TFT_SHADOW_REGS
+//取得tft_SendCmd实际发送与因影子副本而省略的次数，参数可为0
+void tft_GetCmdStat(uint32_t* issued, uint32_t* suppressed);
+
+//清零tft_SendCmd的统计
+void tft_ResetCmdStat();
+
+//作废全部影子副本，直接操作过控制器(如硬件复位)后调用
+void tft_InvalidateShadow();
+#endif
+
+//设置显示窗口并发出RAM写入地址，之后即可用像素流接口填充窗口
+void tft_SetWindow(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY);
+
+/* 像素流接口 */
+/* 片选只在开始时拉低一次，RS保持为高，只在结束时等待移位寄存器排空 */
+
+//开始一次像素流写入，须在tft_SetWindow之后调用
+void tft_BeginPixels();
+
+//向像素流写入一个像素
+void tft_PushPixel(uint16_t color);
+
+//向像素流依次写入count个像素
+void tft_PushPixels(const uint16_t* colors, uint16_t count);
+
+//向像素流写入count个相同颜色的像素
+void tft_PushPixelRepeat(uint16_t color, uint32_t count);
+
+//向像素流写入count个预先转换好的像素，data为大端RGB565字节流(即SPI发送顺序：高字节在前)
+void tft_PushPixelBytes(const uint8_t* data, uint32_t count);
+
+//设置tft_PushMonoBits的前景色与背景色，颜色未变时不重建展开表
+void tft_SetMonoColors(uint16_t fRGB, uint16_t bRGB);
+
+//向像素流写入count个1位像素，位为1取前景色，从bits[0]的第shift位(0为最高位)开始高位在前
+//每个半字节查表展开为4个像素，字符、汉字与单色图标共用
+void tft_PushMonoBits(const uint8_t* bits, uint8_t shift, uint16_t count);
+
+//设置tft_PushShadeBits的前景色与背景色，预先算出4级混合颜色，颜色未变时不重算
+void tft_SetShadeColors(uint16_t fRGB, uint16_t bRGB);
+
+//向像素流写入count个2位灰度像素，0为背景色、3为前景色，从bits[0]的第shift位(偶数)开始高位在前
+//每个像素只查一次表，用于抗锯齿字体
+void tft_PushShadeBits(const uint8_t* bits, uint8_t shift, uint16_t count);
+
+//结束像素流写入，等待最后一位送出后释放片选
+void tft_EndPixels();
+
+#if TFT_USE_TIMING
+//返回最近一次像素流的实测写入速度，单位为像素/秒，计时基于TB0(ACLK)
+uint32_t tft_PixelsPerSecond();
+
+//返回最近一次initTFT从复位到显示开启的耗时，单位为微秒，计时基于TB0(ACLK)
+uint32_t tft_InitTime();
+#endif
+
+#if TFT_USE_DMA
+/* DMA像素流接口，须在tft_BeginPixels与tft_EndPixels之间使用 */
+/* 传输期间CPU可进入LPM0，传输完成后在DMA中断中调用callback(可为0) */
+
+typedef void (*tft_DmaCallback)();
+
+//以DMA写入count个相同颜色的像素，高低字节相同时使用固定源地址，否则循环发送一段颜色图样
+void tft_DmaFill(uint16_t color, uint32_t count, tft_DmaCallback callback);
+
+//以DMA写入count个预先转换好的像素，data为大端RGB565字节流(即SPI发送顺序：高字节在前)
+void tft_DmaWrite(const uint8_t* data, uint32_t count, tft_DmaCallback callback);
+
+//返回DMA传输是否仍在进行
+int tft_DmaBusy();
+
+//等待DMA传输完成，总中断打开时在LPM0中等待
+void tft_DmaWait();
+#endif
+
 /* TFT屏高层接口 */
 /* 所有高层接口内置X、Y对调，即接口处X为横Y为纵 */
 
@@ -59,6 +166,20 @@ void etft_AreaSet(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY
 //在指定的位置显示一个字符串
 void etft_DisplayString(const char* str, uint16_t sx, uint16_t sy, uint16_t fRGB, uint16_t bRGB);
 
+//同etft_DisplayString，但一行内的字符共用一个窗口，按扫描线依次发送所有字符的同一行
+//每行只需设置一次窗口，适合频繁刷新的整行文字
+void etft_DisplayStringLine(const char* str, uint16_t sx, uint16_t sy, uint16_t fRGB, uint16_t bRGB);
+
+//在指定的位置显示一个放大scale倍的字符串，每个字符占8*scale x 16*scale像素
+//每个字符一个窗口，边发送边复制位与扫描线，同色的相邻像素合为一段连续发送，不需要缓冲
+//本行放不下下一个字符时换到下一行，越过屏幕底部时停止；scale为0或单个字符大于屏幕时不显示
+void etft_DisplayStringScaled(const char* str,
+                              uint16_t sx,
+                              uint16_t sy,
+                              uint8_t scale,
+                              uint16_t fRGB,
+                              uint16_t bRGB);
+
 //在指定的位置显示一幅图片，image以24位位图数据区表示
 //即像素顺序从左到右、从下到上(即行顺序倒转)，每3字节一个像素，顺序为B、G、R，每行字节数用0补齐至4的整倍数
 //对常见24位位图，从0x36复制到文件末尾即可
@@ -73,4 +194,38 @@ void etft_DisplayCustomCJK(const char* index_array,
                            uint16_t sy,
                            uint16_t fRGB,
                            uint16_t bRGB);
+
+//在指定的位置显示一幅RGB565图片，image为大端RGB565字节流(extract_bgr.py -f c565生成)
+//像素顺序从左到右、从上到下，每像素2字节，行末不补齐，数据不经任何运算直接送出
+void etft_DisplayImage565(const uint8_t* image,
+                          uint16_t sx,
+                          uint16_t sy,
+                          uint16_t width,
+                          uint16_t height);
+
+//在指定的位置显示一幅行程编码的RGB565图片(extract_bgr.py -f rle生成)，边解码边发送，不占用显存缓冲
+//较长的同色行程走纯色填充的快速路径
+void etft_DisplayImageRLE(const uint8_t* rle,
+                          uint16_t sx,
+                          uint16_t sy,
+                          uint16_t width,
+                          uint16_t height);
+
+//在指定的位置显示一个透明色精灵(extract_bgr.py -f sprite生成)，透明处保留屏幕原有内容
+//精灵按行预先分成不透明段，每段一个窗口连续发送，MCU不逐像素比较透明色
+void etft_DisplaySprite(const uint8_t* sprite, uint16_t sx, uint16_t sy, uint16_t height);
+
+//调色板索引图像(extract_bgr.py -f indexed生成)
+//每像素bpp位(1/2/4/8)，按行打包，字节内高位在前，每行从新的字节开始
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint8_t bpp;
+    const uint8_t* data;
+    const uint16_t* palette; //1<<bpp项RGB565颜色
+} TftIndexedImage;
+
+//在指定的位置显示一幅调色板索引图像，逐像素查表后送出
+//palette为0时使用图像自带的调色板，否则使用传入的调色板(项数相同)，可用于不改图像数据的换色
+void etft_DisplayImageIndexed(const TftIndexedImage* image, const uint16_t* palette, uint16_t sx, uint16_t sy);
 #endif
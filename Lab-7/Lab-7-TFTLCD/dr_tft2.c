@@ -1,75 +1,123 @@
 #include "dr_tft.h"
 #include "dr_tft_ascii.h"
-#include "dr_tft_custom_cjk.h"
+#include "dr_tft_ascii_bbox.h"
+#include "dr_tft_custom_cjk_bbox.h"
 #include <msp430.h>
 
 void etft_AreaSet(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY, uint16_t color) {
-    uint16_t i, j;
-    tft_SendCmd(TFTREG_WIN_MINX, startX);
-    tft_SendCmd(TFTREG_WIN_MINY, startY);
-    tft_SendCmd(TFTREG_WIN_MAXX, endX);
-    tft_SendCmd(TFTREG_WIN_MAXY, endY);
-
-    tft_SendCmd(TFTREG_RAM_XADDR, startX);
-    tft_SendCmd(TFTREG_RAM_YADDR, startY);
-
-    tft_SendIndex(TFTREG_RAM_ACCESS);
-    for (i = 0; i < endY - startY + 1; i++) {
-        for (j = 0; j < endX - startX + 1; j++) {
-            tft_SendData(color);
-        }
-    }
+    uint32_t count = (uint32_t)(endX - startX + 1) * (endY - startY + 1);
+    tft_SetWindow(startX, startY, endX, endY);
+    tft_BeginPixels();
+#if TFT_USE_DMA
+    if (count >= TFT_DMA_MIN_PIXELS) {
+        tft_DmaFill(color, count, 0);
+        tft_DmaWait(); //传输期间CPU处于LPM0
+    } else
+#endif
+        tft_PushPixelRepeat(color, count);
+    tft_EndPixels();
 }
 
 void etft_DisplayString(const char* str, uint16_t sx, uint16_t sy, uint16_t fRGB, uint16_t bRGB) {
     uint16_t cc = 0;
-    uint16_t cx, cy;
 
+    tft_SetMonoColors(fRGB, bRGB);
     while (1) {
         char curchar = str[cc];
         if (curchar == '\0') //字符串已发送完
             return;
 
-        cx = 0;
-        cy = 0;
-        //屏幕是横的，XY要对调
-        tft_SendCmd(TFTREG_WIN_MINX, sx); //x start point
-        tft_SendCmd(TFTREG_WIN_MINY, sy); //y start point
-        tft_SendCmd(TFTREG_WIN_MAXX, sx + 7); //x end point
-        tft_SendCmd(TFTREG_WIN_MAXY, sy + 15); //y end point
-        tft_SendCmd(TFTREG_RAM_XADDR, sx); //x start point
-        tft_SendCmd(TFTREG_RAM_YADDR, sy); //y start point
-        tft_SendIndex(TFTREG_RAM_ACCESS);
-
-        uint16_t color;
-        while (1) {
-            if (cx >= 8) {
-                cx = 0;
-                cy++;
-                if (cy >= 16) { //一个字符发送完毕
-                    cc++; //下一个字符
-                    sx += 8;
-                    if (sx >= TFT_YSIZE) //越过行末
-                    {
-                        sx = 0;
-                        sy += 16;
-                    }
-                    break;
-                }
-            }
+        //屏幕是横的，XY要对调；包围盒字库，空白边距整段发送，只展开墨迹区域
+        etft_DisplayGlyph(&tft_ascii_font, (uint8_t)curchar, sx, sy, bRGB);
 
-            if ((tft_ascii[curchar * 16 + cy] << cx) & 0x80)
-                color = fRGB;
-            else
-                color = bRGB;
+        cc++; //下一个字符
+        sx += 8;
+        if (sx >= TFT_YSIZE) //越过行末
+        {
+            sx = 0;
+            sy += 16;
+        }
+    }
+}
+
+void etft_DisplayStringLine(const char* str, uint16_t sx, uint16_t sy, uint16_t fRGB, uint16_t bRGB) {
+    while (*str != '\0') {
+        uint16_t n = 0, cy, i;
+
+        //本行能放下的字符数
+        while (str[n] != '\0' && sx + (n + 1) * 8 <= TFT_YSIZE)
+            n++;
+        if (n == 0) { //行末已放不下一个字符
+            sx = 0;
+            sy += 16;
+            continue;
+        }
+
+        tft_SetMonoColors(fRGB, bRGB);
+        tft_SetWindow(sx, sy, sx + n * 8 - 1, sy + 15);
+        tft_BeginPixels();
+        for (cy = 0; cy < 16; cy++) {
+            for (i = 0; i < n; i++)
+                tft_PushMonoBits(&tft_ascii[(uint8_t)str[i] * 16 + cy], 0, 8);
+        }
+        tft_EndPixels();
 
-            tft_SendData(color);
-            cx++; //X自增
+        str += n;
+        sx += n * 8;
+        if (sx >= TFT_YSIZE) //越过行末
+        {
+            sx = 0;
+            sy += 16;
         }
     }
 }
 
+void etft_DisplayStringScaled(const char* str,
+                              uint16_t sx,
+                              uint16_t sy,
+                              uint8_t scale,
+                              uint16_t fRGB,
+                              uint16_t bRGB) {
+    uint16_t w = 8 * scale, h = 16 * scale;
+    uint8_t cy, rep;
 
+    if (scale == 0 || w > TFT_YSIZE || h > TFT_XSIZE) //一个字符都放不下屏幕
+        return;
+    while (*str != '\0') {
+        const unsigned char* glyph = &tft_ascii[(uint8_t)*str * 16];
+
+        if (sx + w > TFT_YSIZE) { //本行放不下
+            sx = 0;
+            sy += h;
+        }
+        if (sy + h > TFT_XSIZE) //越过屏幕底部，其余字符不再显示
+            return;
+        tft_SetWindow(sx, sy, sx + w - 1, sy + h - 1);
+        tft_BeginPixels();
+        for (cy = 0; cy < 16; cy++) {
+            uint8_t bits = glyph[cy];
+            if (bits == 0x00 || bits == 0xFF) { //整行同色，scale条扫描线合为一段
+                tft_PushPixelRepeat(bits ? fRGB : bRGB, (uint32_t)w * scale);
+                continue;
+            }
+            for (rep = 0; rep < scale; rep++) { //每条字模行重复scale条扫描线
+                uint8_t b = bits, left = 8;
+                while (left > 0) { //相同颜色的相邻位合为一段
+                    uint8_t on = b & 0x80, n = 0;
+                    while (left > 0 && (b & 0x80) == on) {
+                        n++;
+                        left--;
+                        b <<= 1;
+                    }
+                    tft_PushPixelRepeat(on ? fRGB : bRGB, (uint16_t)n * scale);
+                }
+            }
+        }
+        tft_EndPixels();
+        sx += w;
+        str++;
+    }
+}
 
 void etft_DisplayCustomCJK(const char* index_array,
                            uint16_t sx,
@@ -77,44 +125,17 @@ void etft_DisplayCustomCJK(const char* index_array,
                            uint16_t fRGB,
                            uint16_t bRGB) {
     uint16_t cc = 0;
-    uint16_t cx, cy;
 
+    tft_SetMonoColors(fRGB, bRGB); // 前景色、背景色的展开表
     while (1) {
         char char_value_from_array = index_array[cc]; // Read the raw char value
         if (char_value_from_array == '\0') // Assuming null-terminated string of indices
             return;
 
-        unsigned int char_idx = (unsigned int)char_value_from_array;
-
-        cx = 0;
-        cy = 0;
-        //屏幕是横的，XY要对调
-        tft_SendCmd(TFTREG_WIN_MINX, sx); //x start point
-        tft_SendCmd(TFTREG_WIN_MINY, sy); //y start point
-        tft_SendCmd(TFTREG_WIN_MAXX, sx + 15); //x end point
-        tft_SendCmd(TFTREG_WIN_MAXY, sy + 15); //y end point
-        tft_SendCmd(TFTREG_RAM_XADDR, sx); //x start point
-        tft_SendCmd(TFTREG_RAM_YADDR, sy); //y start point
-        tft_SendIndex(TFTREG_RAM_ACCESS);
-
-        uint16_t color;
-        while (1) {
-            if (cx >= 8) { // 处理一个字节的8个bit
-                cx = 0;    // 重置一个字节中bit的计数到0
-                cy++;      // 切换到这个字符的下一个字节
-                if (cy >= 32) { // 处理完一个字符的32个字节
-                    break;      // 一个字符处理完，切换到下一个字符
-                }
-            }
+        unsigned int char_idx = (uint8_t)char_value_from_array;
 
-            if (tft_cjk_bitmap[char_idx * 32 + cy] & (0x80 >> cx))
-                color = fRGB; // 前景色
-            else
-                color = bRGB; // 背景色
-
-            tft_SendData(color); // 发送像素颜色
-            cx++; // 移动到下一个bit
-        }
+        //屏幕是横的，XY要对调；包围盒字库，空白边距整段发送，只展开墨迹区域
+        etft_DisplayGlyph(&tft_cjk_font, char_idx, sx, sy, bRGB);
 
         cc++; // 切换到下一个字符
         sx += 16; // X轴位置切换到下一个字符
@@ -140,20 +161,125 @@ void etft_DisplayImage(const uint8_t* image,
     }
     // const uint8_t* ptr = image + (height - 1) * row_length;
     const uint8_t* ptr = image;
-    tft_SendCmd(TFTREG_WIN_MINX, sx);
-    tft_SendCmd(TFTREG_WIN_MINY, sy);
-    tft_SendCmd(TFTREG_WIN_MAXX, sx + width - 1);
-    tft_SendCmd(TFTREG_WIN_MAXY, sy + height - 1);
-
-    tft_SendCmd(TFTREG_RAM_XADDR, sx);
-    tft_SendCmd(TFTREG_RAM_YADDR, sy);
-
-    tft_SendIndex(TFTREG_RAM_ACCESS);
+    tft_SetWindow(sx, sy, sx + width - 1, sy + height - 1);
+    tft_BeginPixels();
     for (i = 0; i < height; i++) {
         for (j = 0; j < width; j++) {
-            tft_SendData(etft_Color(ptr[2], ptr[1], ptr[0]));
+            tft_PushPixel(etft_Color(ptr[2], ptr[1], ptr[0]));
             ptr += 3;
         }
         ptr += row_length - 3 * width;
     }
+    tft_EndPixels();
+}
+
+void etft_DisplayImage565(const uint8_t* image,
+                          uint16_t sx,
+                          uint16_t sy,
+                          uint16_t width,
+                          uint16_t height) {
+    uint32_t count = (uint32_t)width * height;
+    tft_SetWindow(sx, sy, sx + width - 1, sy + height - 1);
+    tft_BeginPixels();
+#if TFT_USE_DMA
+    if (count >= TFT_DMA_MIN_PIXELS) {
+        tft_DmaWrite(image, count, 0);
+        tft_DmaWait(); //传输期间CPU处于LPM0
+    } else
+#endif
+        tft_PushPixelBytes(image, count);
+    tft_EndPixels();
+}
+
+void etft_DisplayImageRLE(const uint8_t* rle,
+                          uint16_t sx,
+                          uint16_t sy,
+                          uint16_t width,
+                          uint16_t height) {
+    uint32_t remain = (uint32_t)width * height;
+    tft_SetWindow(sx, sy, sx + width - 1, sy + height - 1);
+    tft_BeginPixels();
+    while (remain > 0) {
+        uint8_t head = *rle++;
+        uint16_t count;
+        if (head < 0x80) { //原样像素
+            count = head + 1;
+            tft_PushPixelBytes(rle, count);
+            rle += count * 2;
+        } else { //同色行程
+            uint16_t color;
+            if (head < 0xC0)
+                count = (head & 0x3F) + 1;
+            else
+                count = (((uint16_t)(head & 0x3F) << 8) | *rle++) + 1;
+            color = ((uint16_t)rle[0] << 8) | rle[1];
+            rle += 2;
+#if TFT_USE_DMA
+            if (count >= TFT_DMA_MIN_PIXELS) {
+                tft_DmaFill(color, count, 0);
+                tft_DmaWait();
+            } else
+#endif
+                tft_PushPixelRepeat(color, count);
+        }
+        remain -= count;
+    }
+    tft_EndPixels();
+}
+
+void etft_DisplaySprite(const uint8_t* sprite, uint16_t sx, uint16_t sy, uint16_t height) {
+    uint16_t y;
+    for (y = 0; y < height; y++) {
+        uint8_t runs = *sprite++;
+        while (runs-- > 0) { //每个不透明段单独一个窗口，透明像素不发送
+            uint16_t x = ((uint16_t)sprite[0] << 8) | sprite[1];
+            uint16_t count = ((uint16_t)sprite[2] << 8) | sprite[3];
+            sprite += 4;
+            tft_SetWindow(sx + x, sy + y, sx + x + count - 1, sy + y);
+            tft_BeginPixels();
+#if TFT_USE_DMA
+            if (count >= TFT_DMA_MIN_PIXELS) {
+                tft_DmaWrite(sprite, count, 0);
+                tft_DmaWait();
+            } else
+#endif
+                tft_PushPixelBytes(sprite, count);
+            tft_EndPixels();
+            sprite += count * 2;
+        }
+    }
+}
+
+void etft_DisplayImageIndexed(const TftIndexedImage* image, const uint16_t* palette, uint16_t sx, uint16_t sy) {
+    const uint8_t* row = image->data;
+    uint8_t bpp = image->bpp;
+    uint8_t mask = (1 << bpp) - 1;
+    uint16_t stride = ((uint32_t)image->width * bpp + 7) >> 3;
+    uint16_t x, y;
+
+    if (!palette)
+        palette = image->palette;
+    tft_SetWindow(sx, sy, sx + image->width - 1, sy + image->height - 1);
+    tft_BeginPixels();
+    if (bpp == 1) { //单色图标，与字模共用查表展开
+        tft_SetMonoColors(palette[1], palette[0]);
+        for (y = 0; y < image->height; y++, row += stride)
+            tft_PushMonoBits(row, 0, image->width);
+        tft_EndPixels();
+        return;
+    }
+    for (y = 0; y < image->height; y++) {
+        const uint8_t* p = row;
+        uint8_t bits = 0, shift = 0;
+        for (x = 0; x < image->width; x++) {
+            if (shift == 0) { //取下一个字节
+                bits = *p++;
+                shift = 8;
+            }
+            shift -= bpp;
+            tft_PushPixel(palette[(bits >> shift) & mask]);
+        }
+        row += stride;
+    }
+    tft_EndPixels();
 }
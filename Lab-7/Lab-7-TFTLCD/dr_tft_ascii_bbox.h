@@ -0,0 +1,310 @@
+#ifndef TFT_ASCII_FONT_H
+#define TFT_ASCII_FONT_H
+
+#include "dr_tft_font.h"
+
+/*
+ * 由gen_font.py从dr_tft_ascii.h生成，请勿手工修改
+ * 字形尺寸: 8 x 16，每像素1位，共257个字形，2980字节(包围盒格式，另有偏移表514字节；整格格式为4112字节)
+ * 字形序号即码位，没有码位表
+ */
+
+const uint8_t tft_ascii_font_bitmap[2980] = {
+    0x00, 0x00, 0x00, 0x00, // 0 0
+    0x04, 0x07, 0x04, 0x08, 0xF8, 0x88, 0x88, 0x88, // 1
+    0x00, 0x07, 0x05, 0x08, 0xF8, 0x42, 0x10, 0x84, 0x21, // 2
+    0x04, 0x00, 0x04, 0x08, 0x88, 0x88, 0x88, 0x8F, // 3
+    0x00, 0x00, 0x05, 0x08, 0x08, 0x42, 0x10, 0x84, 0x3F, // 4
+    0x04, 0x00, 0x01, 0x0F, 0xFF, 0xFE, // 5
+    0x00, 0x07, 0x08, 0x01, 0xFF, // 6
+    0x01, 0x03, 0x06, 0x07, 0x31, 0xEF, 0xFF, 0xFD, 0xE3, 0x00, // 7
+    0x00, 0x00, 0x08, 0x0F, 0xFF, 0xFF, 0xFF, 0xE7, 0xC3, 0x81, 0x81, 0x81, 0xC3, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // 8
+    0x00, 0x00, 0x00, 0x00, // 9
+    0x00, 0x00, 0x00, 0x00, // 10
+    0x01, 0x01, 0x07, 0x0C, 0x3E, 0x14, 0x28, 0x91, 0x24, 0x08, 0x38, 0x89, 0x12, 0x23, 0x80, // 11
+    0x01, 0x01, 0x07, 0x0C, 0x38, 0x89, 0x12, 0x23, 0x82, 0x04, 0x7F, 0x10, 0x20, 0x40, 0x80, // 12
+    0x00, 0x00, 0x00, 0x00, // 13
+    0x01, 0x00, 0x07, 0x0D, 0x06, 0x74, 0x89, 0x33, 0xA4, 0x48, 0x91, 0x26, 0x5D, 0xB7, 0x0C, 0x00, // 14
+    0x01, 0x00, 0x07, 0x0D, 0x10, 0x22, 0xEA, 0x24, 0x48, 0xB1, 0xA2, 0x44, 0x8A, 0xE8, 0x81, 0x00, // 15 0f
+    0x00, 0x00, 0x08, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xFF, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, // 16
+    0x01, 0x01, 0x07, 0x0D, 0x02, 0x0C, 0x38, 0xF3, 0xEF, 0xFF, 0xBF, 0x3E, 0x3C, 0x38, 0x30, 0x20, // 17
+    0x02, 0x00, 0x05, 0x0E, 0x23, 0xAA, 0x42, 0x10, 0x84, 0x21, 0x09, 0x57, 0x10, // 18
+    0x02, 0x01, 0x04, 0x0D, 0x99, 0x99, 0x99, 0x99, 0x90, 0x09, 0x90, // 19
+    0x01, 0x01, 0x07, 0x0C, 0x3E, 0x96, 0x2C, 0x58, 0xA9, 0x4E, 0x85, 0x0A, 0x14, 0x28, 0x50, // 20
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xFF, // 21
+    0x00, 0x07, 0x08, 0x08, 0xFF, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, // 22
+    0x00, 0x00, 0x05, 0x0F, 0x08, 0x42, 0x10, 0x84, 0x3F, 0x08, 0x42, 0x10, 0x84, 0x20, // 23
+    0x02, 0x00, 0x05, 0x0E, 0x23, 0xAA, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, // 24
+    0x04, 0x00, 0x04, 0x0F, 0x88, 0x88, 0x88, 0x8F, 0x88, 0x88, 0x88, 0x80, // 25
+    0x01, 0x05, 0x07, 0x05, 0x08, 0x0B, 0xF8, 0x20, 0x80, // 26
+    0x01, 0x05, 0x07, 0x05, 0x20, 0x83, 0xFA, 0x02, 0x00, // 27
+    0x00, 0x00, 0x00, 0x00, // 28
+    0x00, 0x00, 0x00, 0x00, // 29
+    0x00, 0x00, 0x00, 0x00, // 30
+    0x00, 0x00, 0x00, 0x00, // 31 1F
+    0x00, 0x00, 0x00, 0x00, // 32
+    0x03, 0x02, 0x02, 0x0B, 0xAA, 0xA8, 0x3C, // 33
+    0x01, 0x00, 0x06, 0x04, 0x25, 0xB4, 0xA4, // 34
+    0x00, 0x02, 0x07, 0x0B, 0x24, 0x48, 0x97, 0xF4, 0x89, 0x12, 0x7F, 0x48, 0x91, 0x20, // 35
+    0x01, 0x01, 0x05, 0x0E, 0x23, 0xAB, 0x5A, 0x30, 0xC5, 0x2D, 0x6A, 0xE2, 0x10, // 36
+    0x00, 0x02, 0x07, 0x0B, 0x45, 0x4A, 0xA5, 0x4A, 0x8A, 0x86, 0x95, 0x2A, 0x55, 0x10, // 37
+    0x00, 0x02, 0x08, 0x0B, 0x30, 0x48, 0x48, 0x48, 0x50, 0x6E, 0xA4, 0x94, 0x88, 0x89, 0x76, // 38
+    0x00, 0x00, 0x03, 0x04, 0x6C, 0xE0, // 39
+    0x03, 0x00, 0x04, 0x0E, 0x12, 0x44, 0x88, 0x88, 0x88, 0x44, 0x21, // 40
+    0x01, 0x00, 0x04, 0x0E, 0x84, 0x22, 0x11, 0x11, 0x11, 0x22, 0x48, // 41
+    0x00, 0x03, 0x07, 0x08, 0x10, 0x23, 0x59, 0xC3, 0x9A, 0xC4, 0x08, // 42
+    0x00, 0x03, 0x07, 0x09, 0x10, 0x20, 0x40, 0x8F, 0xE2, 0x04, 0x08, 0x10, // 43
+    0x00, 0x0B, 0x03, 0x04, 0x6C, 0xE0, // 44
+    0x01, 0x07, 0x07, 0x01, 0xFE, // 45
+    0x01, 0x0B, 0x02, 0x02, 0xF0, // 46
+    0x01, 0x01, 0x07, 0x0D, 0x02, 0x08, 0x10, 0x40, 0x82, 0x04, 0x10, 0x20, 0x81, 0x04, 0x08, 0x00, // 47
+    0x01, 0x02, 0x06, 0x0B, 0x31, 0x28, 0x61, 0x86, 0x18, 0x61, 0x85, 0x23, 0x00, // 48
+    0x01, 0x02, 0x05, 0x0B, 0x27, 0x08, 0x42, 0x10, 0x84, 0x21, 0x3E, // 49
+    0x01, 0x02, 0x06, 0x0B, 0x7A, 0x18, 0x61, 0x08, 0x21, 0x08, 0x42, 0x1F, 0xC0, // 50
+    0x01, 0x02, 0x06, 0x0B, 0x7A, 0x18, 0x42, 0x30, 0x20, 0x41, 0x86, 0x27, 0x00, // 51
+    0x01, 0x02, 0x06, 0x0B, 0x08, 0x62, 0x92, 0x4A, 0x28, 0xBF, 0x08, 0x23, 0xC0, // 52
+    0x01, 0x02, 0x06, 0x0B, 0xFE, 0x08, 0x20, 0xB3, 0x20, 0x41, 0x86, 0x27, 0x00, // 53
+    0x01, 0x02, 0x06, 0x0B, 0x39, 0x28, 0x20, 0xB3, 0x28, 0x61, 0x85, 0x23, 0x00, // 54
+    0x01, 0x02, 0x06, 0x0B, 0xFE, 0x28, 0x84, 0x10, 0x82, 0x08, 0x20, 0x82, 0x00, // 55
+    0x01, 0x02, 0x06, 0x0B, 0x7A, 0x18, 0x61, 0x48, 0xC4, 0xA1, 0x86, 0x17, 0x80, // 56
+    0x01, 0x02, 0x06, 0x0B, 0x31, 0x28, 0x61, 0x85, 0x33, 0x41, 0x05, 0x27, 0x00, // 57
+    0x03, 0x05, 0x02, 0x08, 0xF0, 0x0F, // 58
+    0x02, 0x06, 0x02, 0x09, 0x40, 0x05, 0x80, // 59
+    0x01, 0x02, 0x06, 0x0B, 0x04, 0x21, 0x08, 0x42, 0x04, 0x08, 0x10, 0x20, 0x40, // 60
+    0x00, 0x05, 0x07, 0x05, 0xFE, 0x00, 0x00, 0x0F, 0xE0, // 61
+    0x01, 0x02, 0x06, 0x0B, 0x81, 0x02, 0x04, 0x08, 0x10, 0x84, 0x21, 0x08, 0x00, // 62
+    0x01, 0x02, 0x06, 0x0B, 0x7A, 0x18, 0x71, 0x04, 0x21, 0x04, 0x00, 0xC3, 0x00, // 63
+    0x00, 0x02, 0x07, 0x0B, 0x38, 0x89, 0x6D, 0x5A, 0xB5, 0x6A, 0xDA, 0x42, 0x88, 0xE0, // 64
+    0x00, 0x02, 0x08, 0x0B, 0x10, 0x10, 0x18, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x42, 0x42, 0xE7, // 65
+    0x00, 0x02, 0x07, 0x0B, 0xF8, 0x89, 0x12, 0x27, 0x88, 0x90, 0xA1, 0x42, 0x8B, 0xE0, // 66
+    0x00, 0x02, 0x07, 0x0B, 0x3E, 0x85, 0x0C, 0x08, 0x10, 0x20, 0x40, 0x42, 0x88, 0xE0, // 67
+    0x00, 0x02, 0x07, 0x0B, 0xF8, 0x89, 0x0A, 0x14, 0x28, 0x50, 0xA1, 0x42, 0x8B, 0xE0, // 68
+    0x00, 0x02, 0x07, 0x0B, 0xFC, 0x85, 0x22, 0x47, 0x89, 0x12, 0x20, 0x42, 0x87, 0xF0, // 69
+    0x00, 0x02, 0x07, 0x0B, 0xFC, 0x85, 0x22, 0x47, 0x89, 0x12, 0x20, 0x40, 0x83, 0x80, // 70
+    0x00, 0x02, 0x07, 0x0B, 0x3C, 0x89, 0x14, 0x08, 0x10, 0x23, 0xC2, 0x44, 0x88, 0xE0, // 71
+    0x00, 0x02, 0x08, 0x0B, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x42, 0xE7, // 72
+    0x01, 0x02, 0x05, 0x0B, 0xF9, 0x08, 0x42, 0x10, 0x84, 0x21, 0x3E, // 73
+    0x00, 0x02, 0x07, 0x0D, 0x3E, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x24, 0x4F, 0x00, // 74
+    0x00, 0x02, 0x07, 0x0B, 0xEE, 0x89, 0x22, 0x87, 0x0A, 0x12, 0x24, 0x44, 0x8B, 0xB8, // 75
+    0x00, 0x02, 0x07, 0x0B, 0xE0, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x87, 0xF8, // 76
+    0x00, 0x02, 0x07, 0x0B, 0xEE, 0xD9, 0xB3, 0x66, 0xCA, 0x95, 0x2A, 0x54, 0xAB, 0x58, // 77
+    0x00, 0x02, 0x08, 0x0B, 0xC7, 0x62, 0x62, 0x52, 0x52, 0x4A, 0x4A, 0x4A, 0x46, 0x46, 0xE2, // 78
+    0x00, 0x02, 0x07, 0x0B, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x82, 0x88, 0xE0, // 79
+    0x00, 0x02, 0x07, 0x0B, 0xFC, 0x85, 0x0A, 0x14, 0x2F, 0x90, 0x20, 0x40, 0x83, 0x80, // 80
+    0x00, 0x02, 0x07, 0x0C, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xD9, 0xCA, 0x98, 0xE0, 0x30, // 81
+    0x00, 0x02, 0x08, 0x0B, 0xFC, 0x42, 0x42, 0x42, 0x7C, 0x48, 0x48, 0x44, 0x44, 0x42, 0xE3, // 82
+    0x01, 0x02, 0x06, 0x0B, 0x7E, 0x18, 0x60, 0x40, 0xC0, 0x81, 0x86, 0x1F, 0x80, // 83
+    0x00, 0x02, 0x06, 0x0B, 0xFE, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x43, 0x80, // 84
+    0x00, 0x02, 0x08, 0x0B, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, // 85
+    0x00, 0x02, 0x08, 0x0B, 0xE7, 0x42, 0x42, 0x44, 0x24, 0x24, 0x28, 0x28, 0x18, 0x10, 0x10, // 86
+    0x00, 0x02, 0x07, 0x0B, 0xD7, 0x26, 0x4C, 0x99, 0x35, 0x6A, 0xB6, 0x44, 0x89, 0x10, // 87
+    0x00, 0x02, 0x08, 0x0B, 0xE7, 0x42, 0x24, 0x24, 0x18, 0x18, 0x18, 0x24, 0x24, 0x42, 0xE7, // 88
+    0x00, 0x02, 0x07, 0x0B, 0xEE, 0x89, 0x11, 0x42, 0x82, 0x04, 0x08, 0x10, 0x20, 0xE0, // 89
+    0x00, 0x02, 0x07, 0x0B, 0x7F, 0x08, 0x10, 0x40, 0x82, 0x08, 0x10, 0x42, 0x87, 0xF0, // 90
+    0x03, 0x00, 0x04, 0x0E, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8F, // 91
+    0x01, 0x01, 0x06, 0x0E, 0x82, 0x04, 0x10, 0x20, 0x82, 0x04, 0x10, 0x20, 0x82, 0x04, 0x10, // 92
+    0x01, 0x00, 0x04, 0x0E, 0xF1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F, // 93
+    0x02, 0x00, 0x05, 0x02, 0x74, 0x40, // 94
+    0x00, 0x0E, 0x08, 0x01, 0xFF, // 95
+    0x01, 0x00, 0x03, 0x02, 0xC4, // 96
+    0x01, 0x06, 0x07, 0x07, 0x79, 0x08, 0xF2, 0x28, 0x50, 0x9F, 0x80, // 97
+    0x00, 0x02, 0x07, 0x0B, 0xC0, 0x81, 0x02, 0x05, 0x8C, 0x90, 0xA1, 0x42, 0xC9, 0x60, // 98
+    0x01, 0x06, 0x06, 0x07, 0x39, 0x18, 0x20, 0x81, 0x13, 0x80, // 99
+    0x01, 0x02, 0x07, 0x0B, 0x0C, 0x08, 0x10, 0x23, 0xC8, 0xA1, 0x42, 0x84, 0x98, 0xD8, // 100
+    0x01, 0x06, 0x06, 0x07, 0x7A, 0x1F, 0xE0, 0x82, 0x17, 0x80, // 101
+    0x01, 0x02, 0x07, 0x0B, 0x1E, 0x44, 0x81, 0x0F, 0xC4, 0x08, 0x10, 0x20, 0x43, 0xE0, // 102
+    0x01, 0x06, 0x06, 0x09, 0x7E, 0x28, 0x9C, 0x81, 0xE8, 0x61, 0x78, // 103
+    0x00, 0x02, 0x08, 0x0B, 0xC0, 0x40, 0x40, 0x40, 0x5C, 0x62, 0x42, 0x42, 0x42, 0x42, 0xE7, // 104
+    0x01, 0x02, 0x05, 0x0B, 0x63, 0x00, 0x0E, 0x10, 0x84, 0x21, 0x3E, // 105
+    0x01, 0x02, 0x05, 0x0D, 0x18, 0xC0, 0x03, 0x84, 0x21, 0x08, 0x43, 0x1F, 0x00, // 106
+    0x00, 0x02, 0x07, 0x0B, 0xC0, 0x81, 0x02, 0x04, 0xE9, 0x14, 0x34, 0x48, 0x8B, 0xB8, // 107
+    0x01, 0x02, 0x05, 0x0B, 0xE1, 0x08, 0x42, 0x10, 0x84, 0x21, 0x3E, // 108
+    0x00, 0x06, 0x08, 0x07, 0xFE, 0x49, 0x49, 0x49, 0x49, 0x49, 0xED, // 109
+    0x00, 0x06, 0x08, 0x07, 0xDC, 0x62, 0x42, 0x42, 0x42, 0x42, 0xE7, // 110
+    0x01, 0x06, 0x06, 0x07, 0x7A, 0x18, 0x61, 0x86, 0x17, 0x80, // 111
+    0x00, 0x06, 0x07, 0x09, 0xD8, 0xC9, 0x0A, 0x14, 0x28, 0x9E, 0x20, 0xE0, // 112
+    0x01, 0x06, 0x07, 0x09, 0x3C, 0x8A, 0x14, 0x28, 0x48, 0x8F, 0x02, 0x0E, // 113
+    0x00, 0x06, 0x07, 0x07, 0xEE, 0x64, 0x81, 0x02, 0x04, 0x3E, 0x00, // 114
+    0x01, 0x06, 0x06, 0x07, 0x7E, 0x18, 0x1E, 0x06, 0x1F, 0x80, // 115
+    0x01, 0x04, 0x05, 0x09, 0x21, 0x3E, 0x42, 0x10, 0x84, 0x18, // 116
+    0x00, 0x06, 0x08, 0x07, 0xC6, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3B, // 117
+    0x00, 0x06, 0x08, 0x07, 0xE7, 0x42, 0x24, 0x24, 0x28, 0x10, 0x10, // 118
+    0x00, 0x06, 0x08, 0x07, 0xD7, 0x92, 0x92, 0xAA, 0xAA, 0x44, 0x44, // 119
+    0x01, 0x06, 0x06, 0x07, 0xDD, 0x23, 0x0C, 0x31, 0x2E, 0xC0, // 120
+    0x00, 0x06, 0x08, 0x09, 0xE7, 0x42, 0x24, 0x24, 0x28, 0x18, 0x10, 0x10, 0xE0, // 121
+    0x01, 0x06, 0x06, 0x07, 0xFE, 0x21, 0x08, 0x21, 0x1F, 0xC0, // 122
+    0x04, 0x00, 0x04, 0x0E, 0x34, 0x44, 0x44, 0x84, 0x44, 0x44, 0x43, // 123
+    0x04, 0x00, 0x01, 0x0F, 0xFF, 0xFE, // 124
+    0x01, 0x00, 0x04, 0x0E, 0xC2, 0x22, 0x22, 0x12, 0x22, 0x22, 0x2C, // 125
+    0x01, 0x00, 0x07, 0x02, 0x99, 0x0C, // 126
+    0x00, 0x00, 0x00, 0x00, // 127
+    0x00, 0x02, 0x08, 0x0B, 0x1F, 0x23, 0x41, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x40, 0x22, 0x1C, // 128 128
+    0x01, 0x00, 0x07, 0x0D, 0xFF, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x0F, 0xE0, // 129
+    0x01, 0x0A, 0x02, 0x04, 0xF5, // 130
+    0x00, 0x01, 0x08, 0x0E, 0x07, 0x04, 0x04, 0x08, 0x0C, 0x08, 0x08, 0x18, 0x10, 0x10, 0x10, 0x20, 0x20, 0xC0, // 131
+    0x01, 0x0A, 0x06, 0x04, 0x8B, 0x74, 0x62, // 132
+    0x01, 0x05, 0x07, 0x02, 0xC7, 0x8C, // 133
+    0x01, 0x01, 0x06, 0x0D, 0x30, 0xC2, 0x3F, 0x20, 0xC3, 0x08, 0x20, 0x82, 0x08, 0x20, // 134
+    0x01, 0x01, 0x06, 0x0E, 0x30, 0xCE, 0xFF, 0x30, 0x82, 0x08, 0x20, 0xCE, 0xED, 0x30, 0xC0, // 135
+    0x00, 0x01, 0x05, 0x03, 0x32, 0xA2, // 136
+    0x00, 0x00, 0x08, 0x0E, 0x30, 0x48, 0x48, 0x48, 0x49, 0x32, 0x04, 0x08, 0x11, 0x22, 0x42, 0x82, 0x02, 0x01, // 137
+    0x01, 0x00, 0x06, 0x0D, 0x78, 0x07, 0xA1, 0x82, 0x06, 0x06, 0x0C, 0x10, 0x61, 0xF8, // 138
+    0x01, 0x05, 0x03, 0x06, 0x2B, 0x64, 0x40, // 139
+    0x01, 0x02, 0x07, 0x0B, 0x7D, 0x2A, 0x44, 0x89, 0x53, 0xA4, 0x48, 0x91, 0x25, 0xF8, // 140
+    0x01, 0x00, 0x07, 0x0D, 0xFF, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x0F, 0xE0, // 141
+    0x01, 0x00, 0x07, 0x0D, 0x28, 0x20, 0x07, 0xF0, 0x20, 0x82, 0x08, 0x10, 0x41, 0x04, 0x0F, 0xE0, // 142
+    0x01, 0x00, 0x07, 0x0D, 0xFF, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x0F, 0xE0, // 143
+    0x01, 0x00, 0x07, 0x0D, 0xFF, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x0F, 0xE0, // 144
+    0x00, 0x00, 0x00, 0x00, // 145
+    0x00, 0x00, 0x03, 0x05, 0x6C, 0xA8, // 146
+    0x07, 0x02, 0x01, 0x03, 0xE0, // 147
+    0x06, 0x00, 0x02, 0x05, 0x51, 0x80, // 148
+    0x02, 0x05, 0x04, 0x04, 0xFF, 0xF4, // 149
+    0x05, 0x06, 0x03, 0x01, 0xE0, // 150
+    0x00, 0x06, 0x08, 0x01, 0xFF, // 151
+    0x00, 0x01, 0x05, 0x02, 0x65, 0xC0, // 152
+    0x00, 0x01, 0x08, 0x06, 0xE9, 0x4B, 0x4B, 0x5D, 0x55, 0x5F, // 153
+    0x00, 0x01, 0x06, 0x0B, 0x89, 0xC2, 0x0C, 0x49, 0x06, 0x0E, 0x0D, 0x37, 0x80, // 154
+    0x01, 0x05, 0x03, 0x07, 0x89, 0x94, 0xA0, // 155
+    0x01, 0x04, 0x07, 0x08, 0x05, 0xF6, 0x4C, 0xF9, 0x12, 0x26, 0xB6, // 156
+    0x01, 0x00, 0x07, 0x0D, 0xFF, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x0F, 0xE0, // 157
+    0x01, 0x03, 0x05, 0x0A, 0x51, 0x01, 0xF0, 0x88, 0x88, 0x87, 0xC0, // 158
+    0x01, 0x00, 0x06, 0x0D, 0x48, 0x08, 0x62, 0x49, 0x43, 0x0C, 0x20, 0x82, 0x08, 0x78, // 159
+    0x00, 0x00, 0x00, 0x00, // 160
+    0x00, 0x01, 0x08, 0x0E, 0x60, 0x90, 0x90, 0x60, 0x00, 0x0E, 0x11, 0x20, 0x20, 0x20, 0x20, 0x20, 0x11, 0x0E, // 161
+    0x00, 0x01, 0x04, 0x04, 0x69, 0x96, // 162
+    0x02, 0x04, 0x01, 0x0B, 0xDF, 0xE0, // 163
+    0x01, 0x01, 0x06, 0x0E, 0x08, 0x20, 0x8C, 0x5E, 0x7A, 0x28, 0xA1, 0x17, 0xA0, 0x82, 0x00, // 164
+    0x00, 0x02, 0x08, 0x0B, 0x1E, 0x22, 0x20, 0x20, 0x20, 0x38, 0x20, 0x20, 0x21, 0xFA, 0x4C, // 165
+    0x01, 0x00, 0x07, 0x0E, 0x80, 0x9C, 0xC1, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x81, 0x84, 0xF0, 0x00, // 166
+    0x00, 0x02, 0x08, 0x0B, 0x62, 0x24, 0x24, 0x14, 0x18, 0xFF, 0x08, 0xFF, 0x08, 0x08, 0x3C, // 167
+    0x01, 0x01, 0x01, 0x0E, 0xFC, 0xFC, // 168
+    0x04, 0x00, 0x04, 0x0F, 0x88, 0x42, 0x34, 0x88, 0x52, 0x14, 0x88, 0x70, // 169
+    0x04, 0x02, 0x02, 0x02, 0xF0, // 170
+    0x00, 0x03, 0x08, 0x08, 0x7E, 0xA6, 0xC1, 0xC1, 0xC1, 0xA6, 0x5A, 0x24, // 171
+    0x00, 0x01, 0x04, 0x05, 0xE9, 0xF9, 0xF0, // 172
+    0x01, 0x04, 0x07, 0x08, 0x22, 0x89, 0x24, 0x49, 0x89, 0x11, 0x12, // 173
+    0x00, 0x05, 0x08, 0x03, 0xFF, 0x01, 0x01, // 174
+    0x01, 0x08, 0x04, 0x01, 0xF0, // 175
+    0x00, 0x03, 0x08, 0x08, 0x7E, 0xAA, 0xA5, 0xB9, 0xA9, 0xA6, 0x42, 0x3C, // 176
+    0x00, 0x00, 0x00, 0x00, // 177
+    0x01, 0x01, 0x04, 0x04, 0x69, 0x96, // 178
+    0x04, 0x02, 0x04, 0x09, 0x11, 0x1F, 0x11, 0x10, 0xF0, // 179
+    0x00, 0x01, 0x04, 0x06, 0x79, 0x12, 0x5F, // 180
+    0x01, 0x01, 0x03, 0x06, 0xE5, 0x13, 0x80, // 181
+    0x02, 0x01, 0x02, 0x02, 0x60, // 182
+    0x01, 0x04, 0x07, 0x09, 0x44, 0x89, 0x12, 0x24, 0x4B, 0xE8, 0x40, 0x80, // 183
+    0x00, 0x01, 0x07, 0x0D, 0x3F, 0xEB, 0xD7, 0xAF, 0x4E, 0x85, 0x0A, 0x14, 0x28, 0x50, 0xA1, 0x40, // 184
+    0x05, 0x04, 0x03, 0x04, 0x7F, 0xB0, // 185
+    0x01, 0x0C, 0x03, 0x03, 0x47, 0x00, // 186
+    0x01, 0x01, 0x03, 0x06, 0x49, 0x25, 0xC0, // 187
+    0x00, 0x01, 0x05, 0x05, 0x74, 0xE2, 0xA2, 0x00, // 188
+    0x00, 0x04, 0x07, 0x08, 0x88, 0x90, 0x91, 0x13, 0x24, 0x91, 0x44, // 189
+    0x01, 0x01, 0x07, 0x0B, 0x85, 0x12, 0x24, 0x89, 0x14, 0x09, 0x26, 0x4C, 0x9E, 0x00, // 190
+    0x01, 0x01, 0x07, 0x0B, 0x89, 0x12, 0x24, 0x89, 0x14, 0x0B, 0xA1, 0x45, 0x12, 0x38, // 191
+    0x01, 0x01, 0x07, 0x0A, 0xC4, 0x92, 0x22, 0x85, 0x14, 0x09, 0x16, 0x4C, 0x9C, // 192
+    0x01, 0x03, 0x05, 0x0A, 0x21, 0x00, 0x02, 0x21, 0x11, 0x8B, 0xC0, // 193
+    0x00, 0x00, 0x08, 0x0D, 0x10, 0x00, 0x10, 0x18, 0x28, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x44, 0x42, 0xC7, // 194
+    0x00, 0x00, 0x08, 0x0D, 0x10, 0x20, 0x10, 0x18, 0x28, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x44, 0x42, 0xC7, // 195
+    0x00, 0x00, 0x08, 0x0D, 0x28, 0x00, 0x10, 0x18, 0x28, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x44, 0x42, 0xC7, // 196
+    0x00, 0x00, 0x08, 0x0D, 0x0C, 0x00, 0x10, 0x18, 0x28, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x44, 0x42, 0xC7, // 197
+    0x00, 0x00, 0x08, 0x0D, 0x3C, 0x00, 0x10, 0x18, 0x28, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x44, 0x42, 0xC7, // 198
+    0x00, 0x00, 0x08, 0x0D, 0x28, 0x18, 0x10, 0x18, 0x28, 0x28, 0x28, 0x24, 0x3C, 0x44, 0x44, 0x42, 0xC7, // 199
+    0x00, 0x02, 0x08, 0x0B, 0x1E, 0x18, 0x28, 0x28, 0x2A, 0x4E, 0x78, 0x48, 0x48, 0x89, 0xDE, // 200
+    0x01, 0x02, 0x07, 0x0D, 0x38, 0x8E, 0x0C, 0x08, 0x10, 0x20, 0x40, 0xC2, 0xC8, 0x60, 0x81, 0x00, // 201
+    0x00, 0x00, 0x07, 0x0D, 0x10, 0x21, 0xBA, 0x14, 0x08, 0x91, 0x3E, 0x44, 0x81, 0x02, 0x1F, 0xE0, // 202
+    0x00, 0x00, 0x07, 0x0D, 0x08, 0x21, 0xBA, 0x14, 0x08, 0x91, 0x3E, 0x44, 0x81, 0x02, 0x1F, 0xE0, // 203
+    0x00, 0x00, 0x07, 0x0D, 0x28, 0x89, 0xFA, 0x14, 0x08, 0x91, 0x3E, 0x44, 0x81, 0x02, 0x1F, 0xE0, // 204
+    0x00, 0x00, 0x07, 0x0D, 0x2C, 0x01, 0xFA, 0x14, 0x08, 0x91, 0x3E, 0x44, 0x81, 0x02, 0x1F, 0xE0, // 205
+    0x01, 0x00, 0x05, 0x0D, 0x21, 0x1C, 0x42, 0x10, 0x84, 0x21, 0x08, 0x4F, 0x80, // 206
+    0x01, 0x00, 0x05, 0x0D, 0x11, 0x1C, 0x42, 0x10, 0x84, 0x21, 0x08, 0x4F, 0x80, // 207
+    0x01, 0x00, 0x05, 0x0D, 0x50, 0x1C, 0x42, 0x10, 0x84, 0x21, 0x08, 0x4F, 0x80, // 208
+    0x01, 0x00, 0x05, 0x0D, 0x58, 0x1C, 0x42, 0x10, 0x84, 0x21, 0x08, 0x4F, 0x80, // 209
+    0x01, 0x02, 0x07, 0x0B, 0x78, 0x89, 0x12, 0x14, 0x2C, 0x50, 0xA3, 0x44, 0x9B, 0xC0, // 210
+    0x00, 0x00, 0x07, 0x0D, 0x0C, 0x01, 0x0B, 0x16, 0x2A, 0x54, 0xA5, 0x4A, 0x8D, 0x1A, 0x1E, 0x20, // 211
+    0x01, 0x00, 0x06, 0x0D, 0x20, 0x85, 0xA1, 0x86, 0x18, 0x61, 0x86, 0x18, 0x52, 0x30, // 212
+    0x01, 0x00, 0x06, 0x0D, 0x20, 0x85, 0xA1, 0x86, 0x18, 0x61, 0x86, 0x18, 0x52, 0x30, // 213
+    0x01, 0x00, 0x06, 0x0D, 0x52, 0x27, 0xA1, 0x86, 0x18, 0x61, 0x86, 0x18, 0x52, 0x30, // 214
+    0x01, 0x00, 0x06, 0x0D, 0x18, 0x07, 0xA1, 0x86, 0x18, 0x61, 0x86, 0x18, 0x52, 0x30, // 215
+    0x01, 0x00, 0x06, 0x0D, 0x48, 0x07, 0xA1, 0x86, 0x18, 0x61, 0x86, 0x18, 0x52, 0x30, // 216
+    0x03, 0x02, 0x05, 0x09, 0x82, 0x08, 0x20, 0x88, 0x88, 0x80, // 217
+    0x01, 0x02, 0x07, 0x0B, 0x79, 0x0A, 0x34, 0xA9, 0x54, 0xE9, 0x62, 0xC5, 0x11, 0xC0, // 218
+    0x01, 0x00, 0x06, 0x0D, 0x20, 0x08, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18, 0x62, 0x70, // 219
+    0x01, 0x00, 0x06, 0x0D, 0x10, 0x8C, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18, 0x62, 0x70, // 220
+    0x01, 0x00, 0x06, 0x0D, 0x50, 0x08, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18, 0x62, 0x70, // 221
+    0x01, 0x00, 0x06, 0x0D, 0x48, 0x08, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18, 0x62, 0x70, // 222
+    0x01, 0x00, 0x06, 0x0D, 0x10, 0x8C, 0x62, 0x49, 0x43, 0x0C, 0x20, 0x82, 0x08, 0x78, // 223
+    0x01, 0x02, 0x07, 0x0B, 0x40, 0x81, 0xC2, 0x64, 0x28, 0x50, 0xA6, 0x70, 0x83, 0x80, // 224
+    0x01, 0x02, 0x06, 0x0B, 0x39, 0x14, 0x51, 0x59, 0x14, 0x51, 0x45, 0xDD, 0x80, // 225
+    0x01, 0x03, 0x06, 0x0A, 0x20, 0x00, 0x1C, 0x8A, 0x28, 0xA2, 0x89, 0xD0, // 226
+    0x01, 0x03, 0x06, 0x0A, 0x10, 0xC0, 0x1C, 0x8A, 0x28, 0xA2, 0x89, 0xD0, // 227
+    0x01, 0x01, 0x07, 0x0C, 0x60, 0xA2, 0x20, 0x00, 0x1F, 0x22, 0x1C, 0xC9, 0x12, 0x2B, 0xA0, // 228
+    0x01, 0x01, 0x07, 0x0C, 0x41, 0x70, 0x00, 0x00, 0x1F, 0x22, 0x1C, 0xC9, 0x12, 0x2B, 0xA0, // 229
+    0x01, 0x01, 0x07, 0x0C, 0x51, 0xB0, 0x00, 0x00, 0x1F, 0x22, 0x1C, 0xC9, 0x12, 0x2B, 0xA0, // 230
+    0x01, 0x01, 0x07, 0x0C, 0x70, 0xA0, 0x80, 0x00, 0x1F, 0x22, 0x1C, 0xC9, 0x12, 0x2B, 0xA0, // 231
+    0x00, 0x04, 0x08, 0x08, 0x66, 0x99, 0x91, 0x3F, 0x50, 0x90, 0x99, 0x6E, // 232
+    0x01, 0x04, 0x05, 0x0B, 0x36, 0x63, 0x08, 0x46, 0x2E, 0x41, 0x30, // 233
+    0x01, 0x03, 0x06, 0x0A, 0x20, 0x80, 0x1E, 0x86, 0x1F, 0xA0, 0x44, 0xE0, // 234
+    0x01, 0x02, 0x06, 0x0B, 0x08, 0x41, 0x00, 0x7A, 0x18, 0x7E, 0x81, 0x13, 0x80, // 235
+    0x01, 0x02, 0x06, 0x0B, 0x31, 0xC8, 0x80, 0x7A, 0x18, 0x7E, 0x81, 0x13, 0x80, // 236
+    0x01, 0x02, 0x06, 0x0B, 0x59, 0x20, 0x00, 0x7A, 0x18, 0x7E, 0x81, 0x13, 0x80, // 237
+    0x02, 0x02, 0x03, 0x0B, 0x91, 0x04, 0x92, 0x4B, 0x80, // 238
+    0x02, 0x02, 0x03, 0x0B, 0x29, 0x04, 0x92, 0x4B, 0x80, // 239
+    0x01, 0x01, 0x05, 0x0C, 0x22, 0xA4, 0x00, 0x10, 0x84, 0x21, 0x08, 0xF0, // 240
+    0x01, 0x01, 0x05, 0x0C, 0x56, 0xC0, 0x00, 0x10, 0x84, 0x21, 0x08, 0xF0, // 241
+    0x01, 0x02, 0x06, 0x0B, 0x48, 0xC5, 0x02, 0x7E, 0x18, 0x61, 0x86, 0x17, 0x80, // 242
+    0x00, 0x01, 0x07, 0x0C, 0x30, 0x38, 0x00, 0x00, 0x0F, 0x90, 0xA1, 0x42, 0x85, 0x0F, 0x30, // 243
+    0x01, 0x03, 0x06, 0x0A, 0x20, 0x00, 0x1E, 0x86, 0x18, 0x61, 0xCD, 0xE0, // 244
+    0x01, 0x03, 0x06, 0x0A, 0x18, 0x40, 0x1E, 0x86, 0x18, 0x61, 0xCC, 0xC0, // 245
+    0x01, 0x01, 0x06, 0x0C, 0x31, 0x40, 0x80, 0x01, 0xE8, 0x61, 0x86, 0x18, 0x9C, // 246
+    0x01, 0x01, 0x06, 0x0C, 0x60, 0xE0, 0x00, 0x01, 0xE8, 0x61, 0x86, 0x18, 0x9C, // 247
+    0x01, 0x01, 0x06, 0x0C, 0x49, 0x60, 0x00, 0x01, 0xE8, 0x61, 0x86, 0x18, 0x9C, // 248
+    0x03, 0x04, 0x05, 0x05, 0x08, 0x3E, 0x00, 0x80, // 249
+    0x00, 0x06, 0x07, 0x07, 0x3E, 0x8D, 0x2A, 0x96, 0x28, 0xAE, 0x00, // 250
+    0x00, 0x03, 0x07, 0x0A, 0x10, 0x03, 0x12, 0x24, 0x48, 0x91, 0x22, 0x26, 0x74, // 251
+    0x00, 0x02, 0x07, 0x0B, 0x04, 0x10, 0x66, 0x24, 0x48, 0x91, 0x22, 0x44, 0x4C, 0xE8, // 252
+    0x01, 0x01, 0x06, 0x0C, 0x31, 0x48, 0x80, 0x06, 0x18, 0x61, 0x86, 0x18, 0xDC, // 253
+    0x00, 0x03, 0x07, 0x0A, 0x24, 0x4B, 0x12, 0x24, 0x48, 0x91, 0x22, 0x26, 0x74, // 254
+    0x01, 0x01, 0x05, 0x0E, 0x18, 0x88, 0x00, 0x25, 0x29, 0x31, 0x88, 0x42, 0x60, // 255
+    0x00, 0x01, 0x07, 0x0E, 0xC0, 0x81, 0x02, 0x05, 0xE4, 0x50, 0xA1, 0x22, 0x45, 0x52, 0x44, 0x0C, 0x00  // 256
+};
+
+const uint16_t tft_ascii_font_offsets[257] = {
+    0x0000, 0x0004, 0x000C, 0x0015, 0x001D, 0x0026, 0x002C, 0x0031,
+    0x003B, 0x004E, 0x0052, 0x0056, 0x0065, 0x0074, 0x0078, 0x0088,
+    0x0098, 0x00AB, 0x00BB, 0x00C8, 0x00D3, 0x00E2, 0x00EE, 0x00FA,
+    0x0108, 0x0115, 0x0121, 0x012A, 0x0133, 0x0137, 0x013B, 0x013F,
+    0x0143, 0x0147, 0x014E, 0x0155, 0x0163, 0x0170, 0x017E, 0x018D,
+    0x0193, 0x019E, 0x01A9, 0x01B4, 0x01C0, 0x01C6, 0x01CB, 0x01D0,
+    0x01E0, 0x01ED, 0x01F8, 0x0205, 0x0212, 0x021F, 0x022C, 0x0239,
+    0x0246, 0x0253, 0x0260, 0x0266, 0x026D, 0x027A, 0x0283, 0x0290,
+    0x029D, 0x02AB, 0x02BA, 0x02C8, 0x02D6, 0x02E4, 0x02F2, 0x0300,
+    0x030E, 0x031D, 0x0328, 0x0338, 0x0346, 0x0354, 0x0362, 0x0371,
+    0x037F, 0x038D, 0x039C, 0x03AB, 0x03B8, 0x03C5, 0x03D4, 0x03E3,
+    0x03F1, 0x0400, 0x040E, 0x041C, 0x0427, 0x0436, 0x0441, 0x0447,
+    0x044C, 0x0451, 0x045C, 0x046A, 0x0474, 0x0482, 0x048C, 0x049A,
+    0x04A5, 0x04B4, 0x04BF, 0x04CC, 0x04DA, 0x04E5, 0x04F0, 0x04FB,
+    0x0505, 0x0511, 0x051D, 0x0528, 0x0532, 0x053C, 0x0547, 0x0552,
+    0x055D, 0x0567, 0x0574, 0x057E, 0x0589, 0x058F, 0x059A, 0x05A0,
+    0x05A4, 0x05B3, 0x05C3, 0x05C8, 0x05DA, 0x05E1, 0x05E7, 0x05F5,
+    0x0604, 0x060A, 0x061C, 0x062A, 0x0631, 0x063F, 0x064F, 0x065F,
+    0x066F, 0x067F, 0x0683, 0x0689, 0x068E, 0x0694, 0x069A, 0x069F,
+    0x06A4, 0x06AA, 0x06B4, 0x06C1, 0x06C8, 0x06D3, 0x06E3, 0x06EE,
+    0x06FC, 0x0700, 0x0712, 0x0718, 0x071E, 0x072D, 0x073C, 0x074D,
+    0x075C, 0x0762, 0x076E, 0x0773, 0x077F, 0x0786, 0x0791, 0x0798,
+    0x079D, 0x07A9, 0x07AD, 0x07B3, 0x07BC, 0x07C3, 0x07CA, 0x07CF,
+    0x07DB, 0x07EB, 0x07F1, 0x07F7, 0x07FE, 0x0806, 0x0811, 0x081F,
+    0x082D, 0x083A, 0x0845, 0x0856, 0x0867, 0x0878, 0x0889, 0x089A,
+    0x08AB, 0x08BA, 0x08CA, 0x08DA, 0x08EA, 0x08FA, 0x090A, 0x0917,
+    0x0924, 0x0931, 0x093E, 0x094C, 0x095C, 0x096A, 0x0978, 0x0986,
+    0x0994, 0x09A2, 0x09AC, 0x09BA, 0x09C8, 0x09D6, 0x09E4, 0x09F2,
+    0x0A00, 0x0A0E, 0x0A1B, 0x0A27, 0x0A33, 0x0A42, 0x0A51, 0x0A60,
+    0x0A6F, 0x0A7B, 0x0A86, 0x0A92, 0x0A9F, 0x0AAC, 0x0AB9, 0x0AC2,
+    0x0ACB, 0x0AD7, 0x0AE3, 0x0AF0, 0x0AFF, 0x0B0B, 0x0B17, 0x0B24,
+    0x0B31, 0x0B3E, 0x0B46, 0x0B51, 0x0B5E, 0x0B6C, 0x0B79, 0x0B86,
+    0x0B93
+};
+
+const TftFont tft_ascii_font = { 257, 8, 16, 0, tft_ascii_font_bitmap, tft_ascii_font_offsets, 1 };
+
+#endif // TFT_ASCII_FONT_H
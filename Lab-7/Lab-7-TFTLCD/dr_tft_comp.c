@@ -0,0 +1,281 @@
+#include "dr_tft_comp.h"
+
+#if TFT_XSIZE % TFT_COMP_STRIP_H != 0 || TFT_COMP_STRIPS > 32
+#error "TFT_COMP_STRIP_H must divide TFT_XSIZE into at most 32 strips"
+#endif
+
+#define COMP_STRIP_PIXELS ((uint16_t)TFT_YSIZE * TFT_COMP_STRIP_H)
+
+//缓冲中按SPI发送顺序存放(高字节在前)，MSP430为小端，写入前先交换高低字节
+#define COMP_SWAP(c) ((uint16_t)(((c) << 8) | ((c) >> 8)))
+
+extern unsigned char const tft_ascii[]; //定义于dr_tft_ascii.h
+
+static uint16_t* comp_buf[2]; //调用者提供的两个条带缓冲
+static TftCompItem* comp_list; //最底层
+static uint16_t comp_background;
+static uint32_t comp_dirty; //每位对应一个条带
+
+//将屏幕上y~y+h-1行所在的条带标记为脏
+static void comp_Invalidate(int16_t y, uint16_t h) {
+    int16_t y1 = y + (int16_t)h - 1;
+    uint8_t s, s1;
+    if (h == 0 || y1 < 0 || y >= TFT_XSIZE)
+        return;
+    if (y < 0)
+        y = 0;
+    if (y1 > TFT_XSIZE - 1)
+        y1 = TFT_XSIZE - 1;
+    s1 = y1 / TFT_COMP_STRIP_H;
+    for (s = y / TFT_COMP_STRIP_H; s <= s1; s++)
+        comp_dirty |= (uint32_t)1 << s;
+}
+
+static void comp_InvalidateItem(TftCompItem* item) {
+    if (item->visible)
+        comp_Invalidate(item->y, item->h);
+}
+
+void etft_CompInit(uint16_t* buf, uint16_t background) {
+    comp_buf[0] = buf;
+    comp_buf[1] = buf + COMP_STRIP_PIXELS;
+    comp_list = 0;
+    etft_CompSetBackground(background);
+}
+
+void etft_CompSetBackground(uint16_t background) {
+    comp_background = background;
+    comp_dirty = 0xFFFFFFFF;
+}
+
+static void comp_Add(TftCompItem* item, uint8_t type, int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    TftCompItem** p = &comp_list;
+    item->next = 0;
+    item->type = type;
+    item->visible = 1;
+    item->x = x;
+    item->y = y;
+    item->w = w;
+    item->h = h;
+    while (*p) //接在最上层
+        p = &(*p)->next;
+    *p = item;
+    comp_InvalidateItem(item);
+}
+
+void etft_CompAddFill(TftCompItem* item, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    item->color = color;
+    item->data = 0;
+    comp_Add(item, TFT_COMP_FILL, x, y, w, h);
+}
+
+void etft_CompAddFrame(TftCompItem* item, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    item->color = color;
+    item->data = 0;
+    comp_Add(item, TFT_COMP_FRAME, x, y, w, h);
+}
+
+void etft_CompAddImage565(TftCompItem* item, const uint8_t* image, int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    item->data = image;
+    comp_Add(item, TFT_COMP_IMAGE565, x, y, w, h);
+}
+
+void etft_CompAddSprite(TftCompItem* item, const uint8_t* sprite, int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    item->data = sprite;
+    comp_Add(item, TFT_COMP_SPRITE, x, y, w, h);
+}
+
+static uint16_t comp_TextWidth(const char* str) {
+    uint16_t n = 0;
+    while (str[n] != '\0')
+        n++;
+    return n * 8;
+}
+
+void etft_CompAddText(TftCompItem* item, const char* str, int16_t x, int16_t y, uint16_t color) {
+    item->color = color;
+    item->data = str;
+    comp_Add(item, TFT_COMP_TEXT, x, y, comp_TextWidth(str), 16);
+}
+
+void etft_CompRemove(TftCompItem* item) {
+    TftCompItem** p = &comp_list;
+    while (*p && *p != item)
+        p = &(*p)->next;
+    if (!*p)
+        return;
+    *p = item->next;
+    comp_InvalidateItem(item);
+}
+
+void etft_CompMove(TftCompItem* item, int16_t x, int16_t y) {
+    if (item->x == x && item->y == y)
+        return;
+    comp_InvalidateItem(item);
+    item->x = x;
+    item->y = y;
+    comp_InvalidateItem(item);
+}
+
+void etft_CompShow(TftCompItem* item, uint8_t visible) {
+    visible = visible ? 1 : 0;
+    if (item->visible == visible)
+        return;
+    item->visible = 1; //显示与隐藏都要重画所在区域
+    comp_InvalidateItem(item);
+    item->visible = visible;
+}
+
+void etft_CompSetText(TftCompItem* item, const char* str) {
+    comp_InvalidateItem(item);
+    item->data = str;
+    item->w = comp_TextWidth(str);
+    comp_InvalidateItem(item);
+}
+
+void etft_CompTouch(TftCompItem* item) {
+    comp_InvalidateItem(item);
+}
+
+//在条带缓冲中填充rows行、x0~x1列
+static void comp_Fill(uint16_t* row, uint8_t rows, int16_t x0, int16_t x1, uint16_t color) {
+    int16_t x;
+    for (; rows > 0; rows--, row += TFT_YSIZE)
+        for (x = x0; x <= x1; x++)
+            row[x] = color;
+}
+
+//将item中与条带(屏幕第sy行起)重叠的部分画入buf
+static void comp_DrawItem(uint16_t* buf, int16_t sy, const TftCompItem* item) {
+    int16_t r0 = item->y, r1 = item->y + (int16_t)item->h - 1;
+    int16_t x0 = item->x, x1 = item->x + (int16_t)item->w - 1;
+    uint16_t color = COMP_SWAP(item->color);
+    int16_t r, x;
+
+    //与条带及屏幕求交
+    if (r0 < sy)
+        r0 = sy;
+    if (r1 > sy + TFT_COMP_STRIP_H - 1)
+        r1 = sy + TFT_COMP_STRIP_H - 1;
+    if (x0 < 0)
+        x0 = 0;
+    if (x1 > TFT_YSIZE - 1)
+        x1 = TFT_YSIZE - 1;
+    if (r0 > r1 || x0 > x1)
+        return;
+
+    switch (item->type) {
+        case TFT_COMP_FILL:
+            comp_Fill(buf + (r0 - sy) * TFT_YSIZE, r1 - r0 + 1, x0, x1, color);
+            break;
+
+        case TFT_COMP_FRAME:
+            if (item->y >= r0 && item->y <= r1) //上边
+                comp_Fill(buf + (item->y - sy) * TFT_YSIZE, 1, x0, x1, color);
+            r = item->y + (int16_t)item->h - 1;
+            if (r >= r0 && r <= r1) //下边
+                comp_Fill(buf + (r - sy) * TFT_YSIZE, 1, x0, x1, color);
+            if (item->x == x0) //左边
+                comp_Fill(buf + (r0 - sy) * TFT_YSIZE, r1 - r0 + 1, x0, x0, color);
+            x = item->x + (int16_t)item->w - 1;
+            if (x == x1) //右边
+                comp_Fill(buf + (r0 - sy) * TFT_YSIZE, r1 - r0 + 1, x1, x1, color);
+            break;
+
+        case TFT_COMP_IMAGE565: //图像数据已是发送顺序，逐字节复制
+            for (r = r0; r <= r1; r++) {
+                const uint8_t* src = (const uint8_t*)item->data
+                                     + ((uint32_t)(r - item->y) * item->w + (x0 - item->x)) * 2;
+                uint8_t* dst = (uint8_t*)(buf + (r - sy) * TFT_YSIZE + x0);
+                uint16_t n = (x1 - x0 + 1) * 2;
+                while (n-- > 0)
+                    *dst++ = *src++;
+            }
+            break;
+
+        case TFT_COMP_SPRITE: { //逐行跳过条带之前的行，再复制各不透明段中可见的部分
+            const uint8_t* p = (const uint8_t*)item->data;
+            for (r = item->y; r <= r1; r++) {
+                uint8_t runs = *p++;
+                while (runs-- > 0) {
+                    int16_t rx = item->x + (int16_t)(((uint16_t)p[0] << 8) | p[1]);
+                    uint16_t count = ((uint16_t)p[2] << 8) | p[3];
+                    const uint8_t* src = p + 4;
+                    int16_t a = rx < x0 ? x0 : rx, b = rx + (int16_t)count - 1;
+                    uint8_t* dst;
+                    uint16_t n;
+                    p += 4 + count * 2;
+                    if (b > x1)
+                        b = x1;
+                    if (r < r0 || a > b)
+                        continue;
+                    dst = (uint8_t*)(buf + (r - sy) * TFT_YSIZE + a);
+                    src += (a - rx) * 2;
+                    for (n = (b - a + 1) * 2; n > 0; n--)
+                        *dst++ = *src++;
+                }
+            }
+            break;
+        }
+
+        case TFT_COMP_TEXT: { //只画前景像素，背景透明
+            const char* str = (const char*)item->data;
+            int16_t cx;
+            for (cx = item->x; *str != '\0' && cx <= x1; cx += 8, str++) {
+                if (cx + 7 < x0)
+                    continue;
+                for (r = r0; r <= r1; r++) {
+                    uint8_t bits = tft_ascii[(uint8_t)*str * 16 + (r - item->y)];
+                    uint16_t* dst = buf + (r - sy) * TFT_YSIZE;
+                    for (x = cx; bits != 0; x++, bits <<= 1)
+                        if ((bits & 0x80) && x >= x0 && x <= x1)
+                            dst[x] = color;
+                }
+            }
+            break;
+        }
+    }
+}
+
+//按显示列表由底到顶合成屏幕第sy行起的一个条带
+static void comp_Compose(uint16_t* buf, int16_t sy) {
+    const TftCompItem* item;
+    comp_Fill(buf, TFT_COMP_STRIP_H, 0, TFT_YSIZE - 1, COMP_SWAP(comp_background));
+    for (item = comp_list; item; item = item->next)
+        if (item->visible)
+            comp_DrawItem(buf, sy, item);
+}
+
+void etft_CompFlush() {
+    uint8_t s, cur = 0, sending = 0;
+
+    for (s = 0; s < TFT_COMP_STRIPS; s++) {
+        uint16_t sy = s * TFT_COMP_STRIP_H;
+        if (!(comp_dirty & ((uint32_t)1 << s)))
+            continue;
+
+        comp_Compose(comp_buf[cur], sy); //此时上一条带仍在由DMA发送
+        if (sending) {
+#if TFT_USE_DMA
+            tft_DmaWait();
+#endif
+            tft_EndPixels();
+        }
+        tft_SetWindow(0, sy, TFT_YSIZE - 1, sy + TFT_COMP_STRIP_H - 1);
+        tft_BeginPixels();
+#if TFT_USE_DMA
+        tft_DmaWrite((const uint8_t*)comp_buf[cur], COMP_STRIP_PIXELS, 0);
+#else
+        tft_PushPixelBytes((const uint8_t*)comp_buf[cur], COMP_STRIP_PIXELS);
+#endif
+        sending = 1;
+        cur ^= 1;
+    }
+    if (sending) {
+#if TFT_USE_DMA
+        tft_DmaWait();
+#endif
+        tft_EndPixels();
+    }
+    comp_dirty = 0;
+}
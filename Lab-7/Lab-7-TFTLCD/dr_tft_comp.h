@@ -0,0 +1,75 @@
+#ifndef __DR_TFT_COMP_H_
+#define __DR_TFT_COMP_H_
+
+#include "dr_tft.h"
+#include <stdint.h>
+
+/* 条带合成器 */
+/* 整屏帧缓冲需150KB而RAM只有16KB，直接逐层绘制时重叠的控件会闪烁 */
+/* 改为把屏幕按TFT_COMP_STRIP_H行分成水平条带，每条带在RAM中按显示列表由底到顶画好后整条发送 */
+/* 两个条带缓冲交替使用，DMA发送第N条时CPU合成第N+1条；只有被标记为脏的条带才重新合成 */
+/* 条带缓冲由调用者提供，不使用合成器的工程不占用这部分RAM */
+
+//条带高度，须整除TFT_XSIZE且条带数不超过32
+#ifndef TFT_COMP_STRIP_H
+#define TFT_COMP_STRIP_H 8
+#endif
+#define TFT_COMP_STRIPS (TFT_XSIZE / TFT_COMP_STRIP_H)
+
+//etft_CompInit所需缓冲的大小(uint16_t个数)，两个条带共 2 * TFT_YSIZE * TFT_COMP_STRIP_H * 2 字节
+//例如: static uint16_t comp_buf[TFT_COMP_BUF_WORDS];
+#define TFT_COMP_BUF_WORDS (2 * TFT_YSIZE * TFT_COMP_STRIP_H)
+
+//显示项的种类
+enum {
+    TFT_COMP_FILL, //纯色矩形
+    TFT_COMP_FRAME, //矩形边框
+    TFT_COMP_IMAGE565, //etft_DisplayImage565格式的图像
+    TFT_COMP_SPRITE, //etft_DisplaySprite格式的透明色精灵
+    TFT_COMP_TEXT //8x16 ASCII字符串，背景透明
+};
+
+//显示项，由调用者分配，加入显示列表后直到移除前都须保持有效
+typedef struct TftCompItem {
+    struct TftCompItem* next; //上面一层
+    uint8_t type;
+    uint8_t visible;
+    int16_t x, y; //左上角，可以为负或超出屏幕
+    uint16_t w, h;
+    uint16_t color; //FILL、FRAME、TEXT的颜色
+    const void* data; //IMAGE565、SPRITE的数据或TEXT的字符串
+} TftCompItem;
+
+//清空显示列表，设置背景色，整屏标记为脏
+//buf为TFT_COMP_BUF_WORDS个uint16_t的条带缓冲，由调用者分配(栈空间不够，须为静态或全局变量)，使用合成器期间须保持有效
+void etft_CompInit(uint16_t* buf, uint16_t background);
+
+//以下函数初始化item并将其加到显示列表的最上层，所占区域标记为脏
+void etft_CompAddFill(TftCompItem* item, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+void etft_CompAddFrame(TftCompItem* item, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+void etft_CompAddImage565(TftCompItem* item, const uint8_t* image, int16_t x, int16_t y, uint16_t w, uint16_t h);
+void etft_CompAddSprite(TftCompItem* item, const uint8_t* sprite, int16_t x, int16_t y, uint16_t w, uint16_t h);
+void etft_CompAddText(TftCompItem* item, const char* str, int16_t x, int16_t y, uint16_t color);
+
+//从显示列表中移除item
+void etft_CompRemove(TftCompItem* item);
+
+//移动item，原位置与新位置都标记为脏
+void etft_CompMove(TftCompItem* item, int16_t x, int16_t y);
+
+//显示或隐藏item
+void etft_CompShow(TftCompItem* item, uint8_t visible);
+
+//更换TEXT的字符串
+void etft_CompSetText(TftCompItem* item, const char* str);
+
+//修改了item的颜色或数据内容后调用，将其区域标记为脏
+void etft_CompTouch(TftCompItem* item);
+
+//更换背景色，整屏标记为脏
+void etft_CompSetBackground(uint16_t background);
+
+//重新合成并发送所有脏条带
+void etft_CompFlush();
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef TFT_CJK_FONT_H
+#define TFT_CJK_FONT_H
+
+#include "dr_tft_font.h"
+
+/*
+ * 由gen_font.py从dr_tft_custom_cjk.h生成，请勿手工修改
+ * 字形尺寸: 16 x 16，每像素1位，共16个字形，480字节(包围盒格式，另有偏移表32字节；整格格式为512字节)
+ * 字形序号即码位，没有码位表
+ */
+
+const uint8_t tft_cjk_font_bitmap[480] = {
+    0x00, 0x00, 0x00, 0x00, // 0 空字符
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x20, 0xFC, 0x40, 0x08, 0x80, 0x21, 0x00, 0x82, 0x01, 0x15, 0x02, 0xA9, 0x06, 0x52, 0x39, 0x23, 0x92, 0x44, 0x28, 0x88, 0x41, 0x00, 0x82, 0x01, 0x04, 0x0A, 0x28, 0x08, 0x20, // 1 孙
+    0x00, 0x01, 0x0F, 0x0F, 0x1F, 0xF0, 0x20, 0x20, 0x7F, 0xC0, 0x80, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x01, 0x00, 0x02, 0x03, 0xFF, 0xF8, 0x14, 0x00, 0x44, 0x03, 0x06, 0x38, 0x03, 0x80, // 2 昊
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x28, 0x80, 0x48, 0x80, 0x81, 0x3F, 0xF0, 0x42, 0x00, 0x84, 0x39, 0x09, 0x13, 0xD2, 0x24, 0xA4, 0x49, 0x50, 0x92, 0xA1, 0x64, 0x83, 0x69, 0x25, 0x25, 0x42, 0x11, 0x88, 0x41, // 3 诚
+    0x00, 0x00, 0x0F, 0x10, 0x01, 0x01, 0xF2, 0x10, 0x24, 0x20, 0x48, 0x80, 0x92, 0x0F, 0x28, 0x10, 0x40, 0x23, 0xFF, 0x41, 0x40, 0xF2, 0x40, 0x24, 0x80, 0x48, 0x80, 0x90, 0x81, 0x28, 0x94, 0x60, 0x90, 0x80, // 4 张
+    0x00, 0x00, 0x0F, 0x10, 0x08, 0x20, 0x10, 0x43, 0xFF, 0xF8, 0x41, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xC0, 0x82, 0x01, 0x00, 0xFF, 0xF8, 0x0E, 0x00, 0x2A, 0x00, 0x92, 0x06, 0x23, 0x30, 0x41, 0x80, 0x80, // 5 荣
+    0x00, 0x00, 0x0F, 0x10, 0x02, 0x48, 0xF2, 0x91, 0x25, 0x42, 0x7F, 0xE4, 0x84, 0x0F, 0xFF, 0xD2, 0x44, 0x25, 0x04, 0x4D, 0xF6, 0xF0, 0x21, 0x24, 0x42, 0x4F, 0xE4, 0x80, 0x49, 0x7C, 0x92, 0x05, 0x4C, 0x04, // 6 腾
+    0x00, 0x00, 0x0F, 0x10, 0x01, 0x00, 0x05, 0x00, 0x11, 0x00, 0x41, 0x03, 0x01, 0x99, 0xFC, 0xC0, 0x00, 0x1F, 0x04, 0x22, 0x48, 0x7C, 0x90, 0x89, 0x21, 0xF2, 0x42, 0x24, 0x84, 0x41, 0x0A, 0x8A, 0x12, 0x08, // 7 俞
+    0x00, 0x00, 0x0F, 0x10, 0x02, 0x00, 0x02, 0x01, 0xFF, 0xF0, 0x22, 0x02, 0x45, 0x08, 0x89, 0x22, 0x51, 0x08, 0x40, 0x01, 0x00, 0x02, 0x03, 0xFF, 0xF8, 0x14, 0x00, 0x44, 0x01, 0x04, 0x0C, 0x06, 0x60, 0x03, // 8 奕
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x50, 0x00, 0x90, 0x01, 0x01, 0xFF, 0xF2, 0x04, 0x04, 0x08, 0x08, 0x11, 0x1F, 0x22, 0x22, 0x44, 0x44, 0x50, 0x88, 0xA1, 0x10, 0x92, 0xA3, 0x28, 0x89, 0x50, 0x21, 0xC0, 0x81, // 9 成
+    0x00, 0x01, 0x0F, 0x0E, 0x7F, 0xFC, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x0F, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x1F, 0xFF, 0xC0, // 10 王
+    0x00, 0x00, 0x0F, 0x10, 0x10, 0x00, 0x27, 0xFC, 0x40, 0x80, 0xA1, 0x05, 0x82, 0x0A, 0x7F, 0xD4, 0x88, 0xC9, 0x11, 0x12, 0x52, 0x24, 0x94, 0x4A, 0x29, 0x58, 0x12, 0x60, 0x28, 0x40, 0x50, 0x82, 0xC1, 0x02, // 11 炳
+    0x00, 0x00, 0x0F, 0x10, 0x21, 0x08, 0x22, 0x10, 0x4F, 0xF7, 0xC8, 0x40, 0x90, 0x82, 0x3F, 0x04, 0x42, 0x1C, 0x84, 0x55, 0xF9, 0x2A, 0x10, 0x44, 0x20, 0xBF, 0xF1, 0x00, 0x02, 0x12, 0x04, 0x42, 0x09, 0x02, // 12 祺
+    0x00, 0x00, 0x0F, 0x10, 0x10, 0x40, 0x20, 0x80, 0x82, 0x82, 0x08, 0x89, 0x20, 0x82, 0xBE, 0xC8, 0x10, 0x30, 0x20, 0xA7, 0xFC, 0x40, 0x80, 0x89, 0x41, 0x12, 0x42, 0x44, 0x45, 0x08, 0x88, 0x50, 0x10, 0x40, // 13 徐
+    0x00, 0x00, 0x0F, 0x10, 0x00, 0x40, 0x44, 0x80, 0x49, 0x00, 0x9F, 0xE8, 0x44, 0x09, 0x08, 0x10, 0x10, 0x0B, 0xFF, 0x10, 0x00, 0x40, 0x03, 0x8F, 0xE1, 0x10, 0x42, 0x20, 0x84, 0x41, 0x08, 0xFE, 0x01, 0x04, // 14 浩
+    0x00, 0x00, 0x00, 0x00  // 15 全角空格
+};
+
+const uint16_t tft_cjk_font_offsets[16] = {
+    0x0000, 0x0004, 0x0026, 0x0047, 0x0069, 0x008B, 0x00AD, 0x00CF,
+    0x00F1, 0x0113, 0x0135, 0x0154, 0x0176, 0x0198, 0x01BA, 0x01DC
+};
+
+const TftFont tft_cjk_font = { 16, 16, 16, 0, tft_cjk_font_bitmap, tft_cjk_font_offsets, 1 };
+
+#endif // TFT_CJK_FONT_H
@@ -0,0 +1,164 @@
+#include "dr_tft_font.h"
+
+extern unsigned char const tft_ascii[]; //定义于dr_tft_ascii.h
+
+#define FONT_INVALID 0xFFFF //非法序列或超出基本多文种平面
+
+int16_t etft_FontFind(const TftFont* font, uint16_t code) {
+    int16_t lo = 0, hi = (int16_t)font->count - 1;
+    if (!font->codes) //字形序号即码位
+        return code < font->count ? (int16_t)code : -1;
+    while (lo <= hi) {
+        int16_t mid = (lo + hi) >> 1;
+        uint16_t c = font->codes[mid];
+        if (c == code)
+            return mid;
+        if (c < code)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    return -1;
+}
+
+//解码一个UTF-8字符并前移*str
+static uint16_t font_DecodeUTF8(const char** str) {
+    const uint8_t* s = (const uint8_t*)*str;
+    uint32_t code;
+    uint8_t n, i;
+
+    if (s[0] < 0x80) {
+        *str += 1;
+        return s[0];
+    }
+    if ((s[0] & 0xE0) == 0xC0) {
+        code = s[0] & 0x1F;
+        n = 1;
+    } else if ((s[0] & 0xF0) == 0xE0) {
+        code = s[0] & 0x0F;
+        n = 2;
+    } else if ((s[0] & 0xF8) == 0xF0) {
+        code = s[0] & 0x07;
+        n = 3;
+    } else { //孤立的后续字节
+        *str += 1;
+        return FONT_INVALID;
+    }
+    for (i = 1; i <= n; i++) {
+        if ((s[i] & 0xC0) != 0x80) { //序列被截断，从该字节重新开始解码
+            *str += i;
+            return FONT_INVALID;
+        }
+        code = (code << 6) | (s[i] & 0x3F);
+    }
+    *str += n + 1;
+    return code > 0xFFFE ? FONT_INVALID : (uint16_t)code;
+}
+
+//从bits的第pos位起发送count个像素，颜色由tft_SetMonoColors或tft_SetShadeColors设置
+static void font_PushBits(const uint8_t* bits, uint16_t pos, uint16_t count, uint8_t bpp) {
+    if (bpp == 2)
+        tft_PushShadeBits(bits + (pos >> 3), pos & 7, count);
+    else
+        tft_PushMonoBits(bits + (pos >> 3), pos & 7, count);
+}
+
+//在已设置好的窗口中发送一个整格格式的字形，每行stride字节
+static void font_PushGlyph(const uint8_t* glyph, uint8_t width, uint8_t height, uint8_t stride, uint8_t bpp) {
+    uint8_t y;
+    if (width * bpp == stride * 8) { //行间没有填充位，整个字形一次展开
+        font_PushBits(glyph, 0, (uint16_t)width * height, bpp);
+        return;
+    }
+    for (y = 0; y < height; y++, glyph += stride)
+        font_PushBits(glyph, 0, width, bpp);
+}
+
+//在已设置好的窗口中发送一个包围盒格式的字形
+//墨迹区域之前的空白为一段，每行右侧与下一行左侧的空白合为一段，最后一行之后的空白为一段，只有墨迹区域查表展开
+static void font_PushGlyphBox(const uint8_t* glyph, uint8_t width, uint8_t height, uint8_t bpp, uint16_t bRGB) {
+    uint8_t x0 = glyph[0], y0 = glyph[1], w = glyph[2], h = glyph[3];
+    const uint8_t* p = glyph + 4;
+    uint16_t pos = 0; //墨迹点阵中的位序号
+    uint8_t y;
+
+    if (w == 0 || h == 0) { //空白字形
+        tft_PushPixelRepeat(bRGB, (uint16_t)width * height);
+        return;
+    }
+    tft_PushPixelRepeat(bRGB, (uint16_t)y0 * width + x0);
+    for (y = 0; y < h; y++, pos += w * bpp) {
+        font_PushBits(p, pos, w, bpp);
+        if (y + 1 < h)
+            tft_PushPixelRepeat(bRGB, width - w);
+        else
+            tft_PushPixelRepeat(bRGB, (uint16_t)(height - y0 - h) * width + width - x0 - w);
+    }
+}
+
+//空心方框，表示字库中没有的字符
+static void font_PushMissing(uint8_t width, uint8_t height, uint16_t fRGB, uint16_t bRGB) {
+    uint8_t x, y;
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            uint8_t inside = x >= 1 && x <= width - 2 && y >= 1 && y <= height - 2;
+            tft_PushPixel(inside && (x == 1 || x == width - 2 || y == 1 || y == height - 2) ? fRGB : bRGB);
+        }
+    }
+}
+
+void etft_DisplayGlyph(const TftFont* font, uint16_t index, uint16_t sx, uint16_t sy, uint16_t bRGB) {
+    uint8_t w = font->width, h = font->height;
+    uint8_t bpp = font->bpp == 2 ? 2 : 1;
+    uint8_t stride = (w * bpp + 7) >> 3;
+
+    tft_SetWindow(sx, sy, sx + w - 1, sy + h - 1);
+    tft_BeginPixels();
+    if (font->offsets)
+        font_PushGlyphBox(font->bitmap + font->offsets[index], w, h, bpp, bRGB);
+    else
+        font_PushGlyph(font->bitmap + (uint32_t)index * stride * h, w, h, stride, bpp);
+    tft_EndPixels();
+}
+
+void etft_DisplayUTF8(const TftFont* font, const char* str, uint16_t sx, uint16_t sy, uint16_t fRGB, uint16_t bRGB) {
+    uint8_t h = font->height;
+
+    tft_SetMonoColors(fRGB, bRGB); //ASCII回退字模为1位
+    if (font->bpp == 2)
+        tft_SetShadeColors(fRGB, bRGB);
+    while (*str != '\0') {
+        uint16_t code = font_DecodeUTF8(&str);
+        int16_t index;
+        uint8_t w;
+
+        if (code == '\n') {
+            sx = 0;
+            sy += h;
+            continue;
+        }
+        index = code == FONT_INVALID ? -1 : etft_FontFind(font, code);
+        w = (index < 0 && code < 0x80) ? 8 : font->width;
+        if (sx + w > TFT_YSIZE) { //本行放不下
+            sx = 0;
+            sy += h;
+        }
+
+        if (index >= 0) {
+            etft_DisplayGlyph(font, index, sx, sy, bRGB);
+            sx += w;
+            continue;
+        }
+        tft_SetWindow(sx, sy, sx + w - 1, sy + h - 1);
+        tft_BeginPixels();
+        if (code < 0x80) { //ASCII回退到8x16字模，字库比16行高时下方补背景色
+            font_PushGlyph(&tft_ascii[code * 16], 8, h < 16 ? h : 16, 1, 1);
+            if (h > 16)
+                tft_PushPixelRepeat(bRGB, (uint16_t)(h - 16) * 8);
+        } else {
+            font_PushMissing(w, h, fRGB, bRGB);
+        }
+        tft_EndPixels();
+        sx += w;
+    }
+}
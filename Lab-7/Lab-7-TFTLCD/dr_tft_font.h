@@ -0,0 +1,38 @@
+#ifndef __DR_TFT_FONT_H_
+#define __DR_TFT_FONT_H_
+
+#include "dr_tft.h"
+#include <stdint.h>
+
+/* 按Unicode码位索引的点阵字库 */
+/* 字库由util/gen_font.py从BDF/TTF字体生成，只包含字符串实际用到的字形 */
+/* 码位表升序排列，查找为二分法O(log n)，不占用RAM */
+/* 字库放在0x10000以上的FLASH2时指针超过16位，须以大数据模型(--data_model=large)编译，Lab-7工程已使用 */
+/* 包围盒格式的offsets为16位，点阵最多64KB，16x16每像素1位的汉字平均约30字节，即约2000个字形 */
+/* 每像素1位(1为前景色)或2位(0~3为背景色到前景色的4级灰度，用于抗锯齿字体) */
+/* 字形有两种存储格式： */
+/*   整格：offsets为0，每个字形height行，每行(width*bpp+7)/8字节，高位在左 */
+/*   包围盒：offsets[i]为第i个字形在bitmap中的字节偏移，字形为 x0 y0 w h 各1字节，随后w*h个像素的点阵， */
+/*   逐行连续排列不按字节对齐，高位在前；墨迹区域以外的空白不存储，显示时以背景色整段发送 */
+
+typedef struct {
+    uint16_t count; //字形数
+    uint8_t width, height; //字形尺寸(像素)
+    const uint16_t* codes; //升序排列的码位，只支持基本多文种平面(U+0000~U+FFFF)；为0时第i个字形的码位即i
+    const uint8_t* bitmap; //字形数据
+    const uint16_t* offsets; //包围盒格式各字形的偏移，整格格式为0
+    uint8_t bpp; //每像素位数，1或2，为0时按1处理
+} TftFont;
+
+//查找码位为code的字形，返回字形序号，字库中没有时返回-1
+int16_t etft_FontFind(const TftFont* font, uint16_t code);
+
+//在(sx, sy)显示第index个字形，占width x height像素，颜色须先由tft_SetMonoColors或tft_SetShadeColors设置
+//包围盒格式的空白边距以bRGB整段发送
+void etft_DisplayGlyph(const TftFont* font, uint16_t index, uint16_t sx, uint16_t sy, uint16_t bRGB);
+
+//显示UTF-8字符串，'\n'换行，行末放不下时自动换行
+//字库中没有的ASCII字符使用8x16的tft_ascii，其他缺失的字符显示为空心方框
+void etft_DisplayUTF8(const TftFont* font, const char* str, uint16_t sx, uint16_t sy, uint16_t fRGB, uint16_t bRGB);
+
+#endif
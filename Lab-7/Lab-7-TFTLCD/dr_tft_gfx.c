@@ -0,0 +1,280 @@
+#include "dr_tft_gfx.h"
+
+static int16_t clip_x0 = 0, clip_y0 = 0, clip_x1 = TFT_YSIZE - 1, clip_y1 = TFT_XSIZE - 1;
+
+void etft_SetClip(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    clip_x0 = x0 < 0 ? 0 : x0;
+    clip_y0 = y0 < 0 ? 0 : y0;
+    clip_x1 = x1 > TFT_YSIZE - 1 ? TFT_YSIZE - 1 : x1;
+    clip_y1 = y1 > TFT_XSIZE - 1 ? TFT_XSIZE - 1 : y1;
+}
+
+void etft_ResetClip() {
+    etft_SetClip(0, 0, TFT_YSIZE - 1, TFT_XSIZE - 1);
+}
+
+//裁剪后以纯色填充矩形，要求x0<=x1、y0<=y1
+static void gfx_Span(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (x0 < clip_x0)
+        x0 = clip_x0;
+    if (y0 < clip_y0)
+        y0 = clip_y0;
+    if (x1 > clip_x1)
+        x1 = clip_x1;
+    if (y1 > clip_y1)
+        y1 = clip_y1;
+    if (x0 > x1 || y0 > y1)
+        return;
+    etft_AreaSet(x0, y0, x1, y1, color);
+}
+
+void etft_DrawPixel(int16_t x, int16_t y, uint16_t color) {
+    gfx_Span(x, y, x, y, color);
+}
+
+void etft_DrawHLine(int16_t x0, int16_t x1, int16_t y, uint16_t color) {
+    if (x0 > x1)
+        gfx_Span(x1, y, x0, y, color);
+    else
+        gfx_Span(x0, y, x1, y, color);
+}
+
+void etft_DrawVLine(int16_t x, int16_t y0, int16_t y1, uint16_t color) {
+    if (y0 > y1)
+        gfx_Span(x, y1, x, y0, color);
+    else
+        gfx_Span(x, y0, x, y1, color);
+}
+
+void etft_DrawRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int16_t t;
+    if (x0 > x1) {
+        t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    if (y0 > y1) {
+        t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+    gfx_Span(x0, y0, x1, y0, color);
+    if (y1 == y0)
+        return;
+    gfx_Span(x0, y1, x1, y1, color);
+    if (y1 - y0 < 2)
+        return;
+    gfx_Span(x0, y0 + 1, x0, y1 - 1, color); //左右两边不含四角
+    if (x1 != x0)
+        gfx_Span(x1, y0 + 1, x1, y1 - 1, color);
+}
+
+void etft_FillRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    gfx_Span(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0, color);
+}
+
+void etft_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int16_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int16_t dy = y1 > y0 ? y0 - y1 : y1 - y0; //取负值
+    int16_t sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+    int16_t err = dx + dy, e2;
+    int16_t rx = x0, ry = y0; //当前段的起点
+    int16_t px = x0, py = y0; //当前段的终点
+    uint8_t xmajor = dx >= -dy;
+
+    while (px != x1 || py != y1) {
+        e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+        //离开主方向上的这一段时填充它
+        if (xmajor ? y0 != py : x0 != px) {
+            gfx_Span(rx < px ? rx : px, ry < py ? ry : py, rx < px ? px : rx, ry < py ? py : ry, color);
+            rx = x0;
+            ry = y0;
+        }
+        px = x0;
+        py = y0;
+    }
+    gfx_Span(rx < px ? rx : px, ry < py ? ry : py, rx < px ? px : rx, ry < py ? py : ry, color);
+}
+
+//填充八分圆上的一段：x从x0到x1、另一坐标为y，八个对称位置各一段
+static void gfx_CircleSpans(int16_t cx, int16_t cy, int16_t x0, int16_t x1, int16_t y, uint16_t color) {
+    gfx_Span(cx + x0, cy + y, cx + x1, cy + y, color);
+    gfx_Span(cx - x1, cy + y, cx - x0, cy + y, color);
+    gfx_Span(cx + x0, cy - y, cx + x1, cy - y, color);
+    gfx_Span(cx - x1, cy - y, cx - x0, cy - y, color);
+    gfx_Span(cx + y, cy + x0, cx + y, cy + x1, color);
+    gfx_Span(cx - y, cy + x0, cx - y, cy + x1, color);
+    gfx_Span(cx + y, cy - x1, cx + y, cy - x0, color);
+    gfx_Span(cx - y, cy - x1, cx - y, cy - x0, color);
+}
+
+void etft_DrawCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+    int16_t x = 0, y = r, d = 1 - r, xs = 0;
+
+    if (r < 0)
+        return;
+    if (r == 0) {
+        gfx_Span(cx, cy, cx, cy, color);
+        return;
+    }
+    while (x <= y) {
+        if (d < 0) {
+            d += 2 * x + 3;
+        } else { //y即将减小，结束当前段
+            gfx_CircleSpans(cx, cy, xs, x, y, color);
+            d += 2 * (x - y) + 5;
+            y--;
+            xs = x + 1;
+        }
+        x++;
+    }
+    if (xs <= x - 1)
+        gfx_CircleSpans(cx, cy, xs, x - 1, y, color);
+}
+
+void etft_FillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+    int16_t x = 0, y = r, d = 1 - r;
+
+    if (r < 0)
+        return;
+    while (x <= y) {
+        //第cy±x行的宽度每步都变化
+        gfx_Span(cx - y, cy + x, cx + y, cy + x, color);
+        if (x != 0)
+            gfx_Span(cx - y, cy - x, cx + y, cy - x, color);
+        if (d < 0) {
+            d += 2 * x + 3;
+        } else { //第cy±y行只在y减小前填充一次，此时宽度最大
+            if (x != y) {
+                gfx_Span(cx - x, cy + y, cx + x, cy + y, color);
+                gfx_Span(cx - x, cy - y, cx + x, cy - y, color);
+            }
+            d += 2 * (x - y) + 5;
+            y--;
+        }
+        x++;
+    }
+}
+
+//将源区域裁剪到图像范围内、目标区域裁剪到裁剪矩形内，两者同步调整，返回是否还有可见部分
+static int gfx_ClipBlit(uint16_t imgWidth,
+                        uint16_t imgHeight,
+                        uint16_t* srcX,
+                        uint16_t* srcY,
+                        uint16_t* w,
+                        uint16_t* h,
+                        int16_t* dstX,
+                        int16_t* dstY) {
+    int32_t skip;
+
+    if (*srcX >= imgWidth || *srcY >= imgHeight)
+        return 0;
+    if (*w > imgWidth - *srcX)
+        *w = imgWidth - *srcX;
+    if (*h > imgHeight - *srcY)
+        *h = imgHeight - *srcY;
+
+    skip = (int32_t)clip_x0 - *dstX; //左边
+    if (skip > 0) {
+        if (skip >= *w)
+            return 0;
+        *srcX += skip;
+        *w -= skip;
+        *dstX = clip_x0;
+    }
+    skip = (int32_t)clip_y0 - *dstY; //上边
+    if (skip > 0) {
+        if (skip >= *h)
+            return 0;
+        *srcY += skip;
+        *h -= skip;
+        *dstY = clip_y0;
+    }
+    skip = (int32_t)*dstX + *w - 1 - clip_x1; //右边
+    if (skip > 0) {
+        if (skip >= *w)
+            return 0;
+        *w -= skip;
+    }
+    skip = (int32_t)*dstY + *h - 1 - clip_y1; //下边
+    if (skip > 0) {
+        if (skip >= *h)
+            return 0;
+        *h -= skip;
+    }
+    return *w > 0 && *h > 0;
+}
+
+void etft_BlitImage(const uint8_t* image,
+                    uint16_t imgWidth,
+                    uint16_t imgHeight,
+                    uint16_t srcX,
+                    uint16_t srcY,
+                    uint16_t w,
+                    uint16_t h,
+                    int16_t dstX,
+                    int16_t dstY) {
+    uint32_t row_length = ((uint32_t)imgWidth * 3 + 3) & ~(uint32_t)3; //每行字节数补齐至4的整倍数
+    uint16_t i, j;
+
+    if (!gfx_ClipBlit(imgWidth, imgHeight, &srcX, &srcY, &w, &h, &dstX, &dstY))
+        return;
+    tft_SetWindow(dstX, dstY, dstX + w - 1, dstY + h - 1);
+    tft_BeginPixels();
+    for (i = 0; i < h; i++) {
+        const uint8_t* ptr = image + (srcY + i) * row_length + srcX * 3;
+        for (j = 0; j < w; j++) {
+            tft_PushPixel(etft_Color(ptr[2], ptr[1], ptr[0]));
+            ptr += 3;
+        }
+    }
+    tft_EndPixels();
+}
+
+//发送count个大端RGB565像素，较多时由DMA发送
+static void gfx_PushBytes(const uint8_t* data, uint32_t count) {
+#if TFT_USE_DMA
+    if (count >= TFT_DMA_MIN_PIXELS) {
+        tft_DmaWrite(data, count, 0);
+        tft_DmaWait();
+        return;
+    }
+#endif
+    tft_PushPixelBytes(data, count);
+}
+
+void etft_BlitImage565(const uint8_t* image,
+                       uint16_t imgWidth,
+                       uint16_t imgHeight,
+                       uint16_t srcX,
+                       uint16_t srcY,
+                       uint16_t w,
+                       uint16_t h,
+                       int16_t dstX,
+                       int16_t dstY) {
+    const uint8_t* ptr;
+    uint16_t i;
+
+    if (!gfx_ClipBlit(imgWidth, imgHeight, &srcX, &srcY, &w, &h, &dstX, &dstY))
+        return;
+    ptr = image + ((uint32_t)srcY * imgWidth + srcX) * 2;
+    tft_SetWindow(dstX, dstY, dstX + w - 1, dstY + h - 1);
+    tft_BeginPixels();
+    if (w == imgWidth) { //整行，源数据连续
+        gfx_PushBytes(ptr, (uint32_t)w * h);
+    } else {
+        for (i = 0; i < h; i++) {
+            gfx_PushBytes(ptr, w);
+            ptr += (uint32_t)imgWidth * 2;
+        }
+    }
+    tft_EndPixels();
+}
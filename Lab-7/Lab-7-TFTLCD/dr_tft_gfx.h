@@ -0,0 +1,67 @@
+#ifndef __DR_TFT_GFX_H_
+#define __DR_TFT_GFX_H_
+
+#include "dr_tft.h"
+#include <stdint.h>
+
+/* TFT屏二维图元 */
+/* 坐标与其他高层接口相同，X为横(0~319)、Y为纵(0~239)，可以为负或超出屏幕，超出裁剪矩形的部分不绘制 */
+/* 所有图元都分解为水平或竖直的线段，每段设置一次窗口后以纯色填充，不逐像素设置地址 */
+
+//设置裁剪矩形(含边界)，会再与屏幕范围取交集
+void etft_SetClip(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+//裁剪矩形恢复为整个屏幕
+void etft_ResetClip();
+
+//画一个点
+void etft_DrawPixel(int16_t x, int16_t y, uint16_t color);
+
+//画水平线，从(x0, y)到(x1, y)
+void etft_DrawHLine(int16_t x0, int16_t x1, int16_t y, uint16_t color);
+
+//画竖直线，从(x, y0)到(x, y1)
+void etft_DrawVLine(int16_t x, int16_t y0, int16_t y1, uint16_t color);
+
+//画矩形边框，(x0, y0)与(x1, y1)为对角
+void etft_DrawRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+//填充矩形，(x0, y0)与(x1, y1)为对角
+void etft_FillRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+//Bresenham直线，沿主方向连续的像素合为一段填充
+void etft_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+//中点法画圆，每个八分圆上连续的像素合为一段填充
+void etft_DrawCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color);
+
+//填充圆，每条扫描线只填充一次
+void etft_FillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color);
+
+/* 图像局部显示 */
+/* 将图像中以(srcX, srcY)为左上角、w x h的区域显示到(dstX, dstY)，超出图像、屏幕或裁剪矩形的部分不发送 */
+/* 可用于只重绘背景图中被移动的控件遮挡过的部分 */
+
+//image为etft_DisplayImage的24位BGR格式，imgWidth、imgHeight为整幅图像的尺寸
+void etft_BlitImage(const uint8_t* image,
+                    uint16_t imgWidth,
+                    uint16_t imgHeight,
+                    uint16_t srcX,
+                    uint16_t srcY,
+                    uint16_t w,
+                    uint16_t h,
+                    int16_t dstX,
+                    int16_t dstY);
+
+//image为etft_DisplayImage565的大端RGB565格式，区域为整行时整块连续发送
+void etft_BlitImage565(const uint8_t* image,
+                       uint16_t imgWidth,
+                       uint16_t imgHeight,
+                       uint16_t srcX,
+                       uint16_t srcY,
+                       uint16_t w,
+                       uint16_t h,
+                       int16_t dstX,
+                       int16_t dstY);
+
+#endif
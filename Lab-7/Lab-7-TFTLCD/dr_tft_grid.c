@@ -0,0 +1,89 @@
+#include "dr_tft_grid.h"
+
+extern unsigned char const tft_ascii[]; //定义于dr_tft_ascii.h
+
+static const uint16_t grid_default_palette[16] = {
+    0x0000, 0x0015, 0x0540, 0x0555, 0xA800, 0xA815, 0xAAA0, 0xAD55,
+    0x52AA, 0x52BF, 0x57EA, 0x57FF, 0xFAAA, 0xFABF, 0xFFEA, 0xFFFF
+};
+
+static char grid_char[TFT_GRID_ROWS][TFT_GRID_COLS];
+static uint8_t grid_attr[TFT_GRID_ROWS][TFT_GRID_COLS];
+static uint8_t grid_dirty[TFT_GRID_ROWS][(TFT_GRID_COLS + 7) / 8]; //每位对应一格
+static const uint16_t* grid_palette = grid_default_palette;
+
+void etft_GridInit(const uint16_t* palette, uint8_t attr) {
+    uint8_t row, col;
+    grid_palette = palette ? palette : grid_default_palette;
+    for (row = 0; row < TFT_GRID_ROWS; row++) {
+        for (col = 0; col < TFT_GRID_COLS; col++) {
+            grid_char[row][col] = ' ';
+            grid_attr[row][col] = attr;
+        }
+        for (col = 0; col < sizeof(grid_dirty[0]); col++)
+            grid_dirty[row][col] = 0xFF;
+    }
+}
+
+void etft_GridPutChar(uint8_t col, uint8_t row, char ch, uint8_t attr) {
+    if (col >= TFT_GRID_COLS || row >= TFT_GRID_ROWS)
+        return;
+    if (grid_char[row][col] == ch && grid_attr[row][col] == attr)
+        return;
+    grid_char[row][col] = ch;
+    grid_attr[row][col] = attr;
+    grid_dirty[row][col >> 3] |= 0x80 >> (col & 7);
+}
+
+uint8_t etft_GridPrint(uint8_t col, uint8_t row, const char* str, uint8_t attr) {
+    uint8_t n = 0;
+    while (str[n] != '\0' && col + n < TFT_GRID_COLS) {
+        etft_GridPutChar(col + n, row, str[n], attr);
+        n++;
+    }
+    return n;
+}
+
+//第row行第col格是否有变化
+static int grid_IsDirty(uint8_t row, uint8_t col) {
+    return grid_dirty[row][col >> 3] & (0x80 >> (col & 7));
+}
+
+//发送第row行中从first到last的连续格子，按扫描线依次发送各格的同一行
+static void grid_FlushRun(uint8_t row, uint8_t first, uint8_t last) {
+    uint8_t col, cy;
+    tft_SetWindow(first * 8, row * 16, last * 8 + 7, row * 16 + 15);
+    tft_BeginPixels();
+    for (cy = 0; cy < 16; cy++) {
+        for (col = first; col <= last; col++) {
+            uint8_t attr = grid_attr[row][col];
+            //相邻格子颜色相同时展开表不重建
+            tft_SetMonoColors(grid_palette[attr & 0x0F], grid_palette[attr >> 4]);
+            tft_PushMonoBits(&tft_ascii[(uint8_t)grid_char[row][col] * 16 + cy], 0, 8);
+        }
+    }
+    tft_EndPixels();
+}
+
+void etft_GridFlush() {
+    uint8_t row, col, first;
+    for (row = 0; row < TFT_GRID_ROWS; row++) {
+        col = 0;
+        while (col < TFT_GRID_COLS) {
+            if (grid_dirty[row][col >> 3] == 0) { //整字节无变化，跳过8格
+                col = (col | 7) + 1;
+                continue;
+            }
+            if (!grid_IsDirty(row, col)) {
+                col++;
+                continue;
+            }
+            first = col;
+            while (col < TFT_GRID_COLS && grid_IsDirty(row, col))
+                col++;
+            grid_FlushRun(row, first, col - 1);
+        }
+        for (col = 0; col < sizeof(grid_dirty[0]); col++)
+            grid_dirty[row][col] = 0;
+    }
+}
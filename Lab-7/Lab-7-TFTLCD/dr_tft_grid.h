@@ -0,0 +1,50 @@
+#ifndef __DR_TFT_GRID_H_
+#define __DR_TFT_GRID_H_
+
+#include "dr_tft.h"
+#include <stdint.h>
+
+/* 字符网格控制台 */
+/* 屏幕按8x16字符划分为40x15个格子，每格保存字符与颜色属性，写入只修改缓冲并标记变化的格子 */
+/* etft_GridFlush只发送有变化的格子，同一行中相邻的变化格子合并为一个窗口 */
+
+#define TFT_GRID_COLS (TFT_YSIZE / 8)
+#define TFT_GRID_ROWS (TFT_XSIZE / 16)
+
+//由前景、背景调色板下标组成颜色属性
+#define TFT_GRID_ATTR(fg, bg) ((uint8_t)(((bg) << 4) | ((fg) & 0x0F)))
+
+//默认调色板的颜色下标
+enum {
+    TFT_GRID_BLACK,
+    TFT_GRID_BLUE,
+    TFT_GRID_GREEN,
+    TFT_GRID_CYAN,
+    TFT_GRID_RED,
+    TFT_GRID_MAGENTA,
+    TFT_GRID_BROWN,
+    TFT_GRID_GRAY,
+    TFT_GRID_DARKGRAY,
+    TFT_GRID_LIGHTBLUE,
+    TFT_GRID_LIGHTGREEN,
+    TFT_GRID_LIGHTCYAN,
+    TFT_GRID_LIGHTRED,
+    TFT_GRID_LIGHTMAGENTA,
+    TFT_GRID_YELLOW,
+    TFT_GRID_WHITE
+};
+
+//清空网格(空格、attr属性)并将所有格子标记为变化
+//palette为16项RGB565颜色，为0时使用默认调色板
+void etft_GridInit(const uint16_t* palette, uint8_t attr);
+
+//修改一个格子，内容不变时不做标记
+void etft_GridPutChar(uint8_t col, uint8_t row, char ch, uint8_t attr);
+
+//从(col, row)开始写入字符串，超出行末的部分被截去，返回写入的字符数
+uint8_t etft_GridPrint(uint8_t col, uint8_t row, const char* str, uint8_t attr);
+
+//将有变化的格子送往屏幕
+void etft_GridFlush();
+
+#endif
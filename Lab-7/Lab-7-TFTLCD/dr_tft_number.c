@@ -0,0 +1,76 @@
+#include "dr_tft_number.h"
+
+//将value右对齐格式化到buf[0..width-1]，放不下时返回0
+static int number_Format(char* buf, uint8_t width, uint8_t decimals, int32_t value) {
+    uint32_t mag = value < 0 ? 0 - (uint32_t)value : (uint32_t)value;
+    uint8_t pos = width, digits;
+
+    for (digits = 0; mag != 0 || digits <= decimals; digits++) {
+        if (digits == decimals && decimals != 0) { //整数部分的第一位之前为小数点
+            if (pos == 0)
+                return 0;
+            buf[--pos] = '.';
+        }
+        if (pos == 0)
+            return 0;
+        buf[--pos] = '0' + mag % 10;
+        mag /= 10;
+    }
+    if (value < 0) {
+        if (pos == 0)
+            return 0;
+        buf[--pos] = '-';
+    }
+    while (pos > 0)
+        buf[--pos] = ' ';
+    return 1;
+}
+
+void etft_NumberFieldInit(TftNumberField* field,
+                          uint16_t sx,
+                          uint16_t sy,
+                          uint8_t width,
+                          uint8_t decimals,
+                          uint16_t fRGB,
+                          uint16_t bRGB) {
+    field->sx = sx;
+    field->sy = sy;
+    field->width = width > TFT_NUMBER_MAX_WIDTH ? TFT_NUMBER_MAX_WIDTH : width;
+    field->decimals = decimals;
+    field->fRGB = fRGB;
+    field->bRGB = bRGB;
+    etft_NumberFieldInvalidate(field);
+}
+
+void etft_NumberFieldSet(TftNumberField* field, int32_t value) {
+    char buf[TFT_NUMBER_MAX_WIDTH + 1];
+    uint8_t i, first;
+
+    if (!number_Format(buf, field->width, field->decimals, value))
+        for (i = 0; i < field->width; i++)
+            buf[i] = '#';
+
+    //相邻的变化字符合并为一次etft_DisplayStringLine
+    i = 0;
+    while (i < field->width) {
+        if (buf[i] == field->shown[i]) {
+            i++;
+            continue;
+        }
+        first = i;
+        while (i < field->width && buf[i] != field->shown[i]) {
+            field->shown[i] = buf[i];
+            i++;
+        }
+        buf[i] = '\0';
+        etft_DisplayStringLine(&buf[first], field->sx + first * 8, field->sy, field->fRGB, field->bRGB);
+        if (i < field->width)
+            buf[i] = field->shown[i]; //被截断处原本与屏幕一致
+    }
+}
+
+void etft_NumberFieldInvalidate(TftNumberField* field) {
+    uint8_t i;
+    for (i = 0; i < TFT_NUMBER_MAX_WIDTH; i++)
+        field->shown[i] = '\0';
+}
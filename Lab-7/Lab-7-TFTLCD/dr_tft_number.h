@@ -0,0 +1,39 @@
+#ifndef __DR_TFT_NUMBER_H_
+#define __DR_TFT_NUMBER_H_
+
+#include "dr_tft.h"
+#include <stdint.h>
+
+/* 数值显示框 */
+/* 记住屏幕上已显示的字符，更新时只重绘发生变化的字符位置，适合高频刷新的读数 */
+/* 格式化不依赖stdio */
+
+//数值框最多的字符数(含符号与小数点)
+#define TFT_NUMBER_MAX_WIDTH 12
+
+typedef struct {
+    uint16_t sx, sy; //左上角
+    uint8_t width; //字符数，数值右对齐
+    uint8_t decimals; //小数位数
+    uint16_t fRGB, bRGB;
+    char shown[TFT_NUMBER_MAX_WIDTH]; //屏幕上当前的字符，'\0'表示需要重绘
+} TftNumberField;
+
+//初始化数值框，width个8x16字符宽，decimals为小数位数(0为整数)
+//此时不绘制，第一次etft_NumberFieldSet时绘制全部字符
+void etft_NumberFieldInit(TftNumberField* field,
+                          uint16_t sx,
+                          uint16_t sy,
+                          uint8_t width,
+                          uint8_t decimals,
+                          uint16_t fRGB,
+                          uint16_t bRGB);
+
+//显示value，value以10^-decimals为单位的定点数表示，如decimals为3时1234显示为1.234
+//放不下时全部显示为'#'
+void etft_NumberFieldSet(TftNumberField* field, int32_t value);
+
+//屏幕被其他绘图覆盖后调用，下一次etft_NumberFieldSet将重绘全部字符
+void etft_NumberFieldInvalidate(TftNumberField* field);
+
+#endif
@@ -0,0 +1,162 @@
+#include "dr_tft_qoi.h"
+#include "dr_tft.h"
+
+#define QOI_OP_DIFF 0x40
+#define QOI_OP_LUMA 0x80
+#define QOI_OP_RUN 0xC0
+#define QOI_OP_RUN16 0xFD
+#define QOI_OP_RGB 0xFE
+#define QOI_OP_RAW 0xFF
+
+//交换高低字节，得到在内存中按大端排列的像素；MSP430上为一条SWPB指令
+#ifdef __TI_COMPILER_VERSION__
+#include <msp430.h>
+#define QOI_SWAP(c) __swap_bytes(c)
+#else
+#define QOI_SWAP(c) ((uint16_t)((c) << 8 | (c) >> 8))
+#endif
+
+/* 编码器保证DIFF/LUMA的各分量不回绕，差值可以直接加到打包的RGB565上，无需拆分r/g/b */
+
+//DIFF: 01rrggbb，各分量差为-2~1
+#define QOI_DIFF(o) ((uint16_t)((long)(((o) >> 4) - 2) * 2048 + (long)((((o) >> 2) & 3) - 2) * 32 + ((o) & 3) - 2))
+#define QOI_DIFF4(o) QOI_DIFF(o), QOI_DIFF(o + 1), QOI_DIFF(o + 2), QOI_DIFF(o + 3)
+#define QOI_DIFF16(o) QOI_DIFF4(o), QOI_DIFF4(o + 4), QOI_DIFF4(o + 8), QOI_DIFF4(o + 12)
+static const uint16_t qoi_diff[64] = {
+    QOI_DIFF16(0), QOI_DIFF16(16), QOI_DIFF16(32), QOI_DIFF16(48)
+};
+
+//LUMA第一字节: 10gggggg，dg为o-32，r、b各加dg/2(向下取整)；第二字节的偏置-0x4008也并在这里
+#define QOI_LUMA(o) ((uint16_t)((long)(((o) >> 1) - 16) * 2049 + (long)((o) - 32) * 32 - 0x4008))
+#define QOI_LUMA4(o) QOI_LUMA(o), QOI_LUMA(o + 1), QOI_LUMA(o + 2), QOI_LUMA(o + 3)
+#define QOI_LUMA16(o) QOI_LUMA4(o), QOI_LUMA4(o + 4), QOI_LUMA4(o + 8), QOI_LUMA4(o + 12)
+static const uint16_t qoi_luma[64] = {
+    QOI_LUMA16(0), QOI_LUMA16(16), QOI_LUMA16(32), QOI_LUMA16(48)
+};
+
+//LUMA第二字节: rrrrbbbb，偏置8已并入qoi_luma
+#define QOI_RB(s) ((uint16_t)(((s) >> 4) * 2048u + ((s) & 0x0F)))
+#define QOI_RB4(s) QOI_RB(s), QOI_RB(s + 1), QOI_RB(s + 2), QOI_RB(s + 3)
+#define QOI_RB16(s) QOI_RB4(s), QOI_RB4(s + 4), QOI_RB4(s + 8), QOI_RB4(s + 12)
+static const uint16_t qoi_luma_rb[256] = {
+    QOI_RB16(0x00), QOI_RB16(0x10), QOI_RB16(0x20), QOI_RB16(0x30),
+    QOI_RB16(0x40), QOI_RB16(0x50), QOI_RB16(0x60), QOI_RB16(0x70),
+    QOI_RB16(0x80), QOI_RB16(0x90), QOI_RB16(0xA0), QOI_RB16(0xB0),
+    QOI_RB16(0xC0), QOI_RB16(0xD0), QOI_RB16(0xE0), QOI_RB16(0xF0)
+};
+
+//栈空间有限，解码器与缓冲都放在静态区
+static TftQoiDecoder qoi_dec;
+static uint16_t qoi_buf[2][TFT_QOI_CHUNK];
+
+void tft_QoiInit(TftQoiDecoder* dec, const uint8_t* src) {
+    uint16_t i;
+    dec->src = src;
+    dec->px = 0;
+    dec->run = 0;
+    dec->raw = 0;
+    for (i = 0; i < 64; i++)
+        dec->index[i] = 0;
+}
+
+void tft_QoiDecode(TftQoiDecoder* dec, uint16_t* out, uint16_t count) {
+    const uint8_t* src = dec->src;
+    uint16_t* index = dec->index;
+    uint16_t px = dec->px, sw, n;
+    uint16_t run = dec->run, raw = dec->raw;
+    uint8_t op;
+
+    while (count > 0) {
+        if (run > 0) { //RUN，同一颜色整段写出
+            n = run < count ? run : count;
+            run -= n;
+            count -= n;
+            sw = QOI_SWAP(px);
+            do
+                *out++ = sw;
+            while (--n);
+            continue;
+        }
+        if (raw > 0) { //RAW，编码数据不一定按字对齐，逐字节复制
+            uint8_t* p = (uint8_t*)out;
+            n = raw < count ? raw : count;
+            raw -= n;
+            count -= n;
+            out += n;
+            do {
+                *p++ = *src++;
+                *p++ = *src++;
+            } while (--n);
+            px = ((uint16_t)src[-2] << 8) | src[-1];
+            continue;
+        }
+        do {
+            op = *src++;
+            if (op < QOI_OP_DIFF) { //INDEX，不更新索引表
+                px = index[op];
+                *out++ = QOI_SWAP(px);
+                continue;
+            }
+            if (op < QOI_OP_LUMA) { //DIFF，不更新索引表
+                px += qoi_diff[op - QOI_OP_DIFF];
+                *out++ = QOI_SWAP(px);
+                continue;
+            }
+            if (op < QOI_OP_RUN) { //LUMA
+                px += qoi_luma[op - QOI_OP_LUMA] + qoi_luma_rb[*src++];
+            } else if (op == QOI_OP_RGB) {
+                px = ((uint16_t)src[0] << 8) | src[1];
+                src += 2;
+            } else { //RUN、RUN16与RAW，交给外层循环整段写出
+                if (op < QOI_OP_RUN16) {
+                    run = op - QOI_OP_RUN + 1;
+                } else if (op == QOI_OP_RUN16) {
+                    run = (((uint16_t)src[0] << 8) | src[1]) + 1;
+                    src += 2;
+                } else {
+                    raw = *src++ + 1;
+                }
+                break;
+            }
+            //LUMA与RGB写出并更新索引表，哈希为(px>>8 ^ px)%64，正好借用交换后的sw
+            sw = QOI_SWAP(px);
+            *out++ = sw;
+            index[(sw ^ px) & 63] = px;
+        } while (--count);
+    }
+
+    dec->src = src;
+    dec->px = px;
+    dec->run = run;
+    dec->raw = raw;
+}
+
+void etft_DisplayImageQOI(const uint8_t* data,
+                          uint16_t sx,
+                          uint16_t sy,
+                          uint16_t width,
+                          uint16_t height) {
+    uint32_t remain = (uint32_t)width * height;
+    uint8_t cur = 0;
+
+    tft_QoiInit(&qoi_dec, data);
+    tft_SetWindow(sx, sy, sx + width - 1, sy + height - 1);
+    tft_BeginPixels();
+    while (remain > 0) {
+        uint16_t n = remain > TFT_QOI_CHUNK ? TFT_QOI_CHUNK : remain;
+        tft_QoiDecode(&qoi_dec, qoi_buf[cur], n);
+#if TFT_USE_DMA
+        //解码下一块的同时由DMA发送上一块
+        tft_DmaWait();
+        tft_DmaWrite((const uint8_t*)qoi_buf[cur], n, 0);
+#else
+        tft_PushPixelBytes((const uint8_t*)qoi_buf[cur], n);
+#endif
+        cur ^= 1;
+        remain -= n;
+    }
+#if TFT_USE_DMA
+    tft_DmaWait();
+#endif
+    tft_EndPixels();
+}
@@ -0,0 +1,36 @@
+#ifndef __DR_TFT_QOI_H_
+#define __DR_TFT_QOI_H_
+
+#include <stdint.h>
+
+/* QOI565图像解码 */
+/* 编码格式见util/extract_bgr.py中的encode_qoi565，由extract_bgr.py -f qoi生成 */
+/* 解码只需64项颜色索引表，边解码边送往TFT屏，不需要整幅图像的缓冲 */
+
+//每次解码后送出的像素数，两块缓冲轮流使用
+//编码器按同样的分块估算解码周期数，修改时同步修改extract_bgr.py中的QOI565_CHUNK
+#define TFT_QOI_CHUNK 128
+
+//解码器状态
+typedef struct {
+    const uint8_t* src; //下一个待读的编码字节
+    uint16_t px; //前一像素
+    uint16_t run; //RUN指令剩余的重复次数
+    uint16_t raw; //RAW指令剩余的像素数
+    uint16_t index[64]; //颜色索引表
+} TftQoiDecoder;
+
+//从编码数据src的开头开始解码
+void tft_QoiInit(TftQoiDecoder* dec, const uint8_t* src);
+
+//解码接下来的count个像素写入out，每个字在内存中按大端RGB565排列，可直接送往SPI
+void tft_QoiDecode(TftQoiDecoder* dec, uint16_t* out, uint16_t count);
+
+//在指定的位置显示一幅QOI565编码的图片
+void etft_DisplayImageQOI(const uint8_t* data,
+                          uint16_t sx,
+                          uint16_t sy,
+                          uint16_t width,
+                          uint16_t height);
+
+#endif
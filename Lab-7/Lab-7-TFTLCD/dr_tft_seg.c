@@ -0,0 +1,117 @@
+#include "dr_tft_seg.h"
+
+#define SEG_REDRAW 0x80
+
+//与2-LCD/dr_lcdseg.c相同的段码
+static const uint8_t SEG_CTRL_BIN[21] = {
+    0x3F, //display 0
+    0x06, //display 1
+    0x5B, //display 2
+    0x4F, //display 3
+    0x66, //display 4
+    0x6D, //display 5
+    0x7D, //display 6
+    0x07, //display 7
+    0x7F, //display 8
+    0x6F, //display 9
+    0x77, //display A
+    0x7C, //display b
+    0x39, //display C
+    0x5E, //display d
+    0x79, //display E
+    0x71, //display F
+    0x40, //display -
+    0x6D, // S (与5相同)
+    0x1E, // J (自定义段码)
+    0x07, // T (自定义段码)
+    0x3E // U (自定义段码)
+};
+
+//将第seg段(0~6对应a~g)填为color，各段互不重叠，四角留空
+static void seg_Fill(const TftSegDigit* digit, uint8_t seg, uint16_t color) {
+    uint16_t x0 = digit->sx, y0 = digit->sy, t = digit->thick;
+    uint16_t x1 = x0 + digit->width - 1, y1 = y0 + digit->height - 1;
+    uint16_t mid = y0 + (digit->height - t) / 2; //g段的上边
+
+    switch (seg) {
+        case 0: //a
+            etft_AreaSet(x0 + t, y0, x1 - t, y0 + t - 1, color);
+            break;
+        case 1: //b
+            etft_AreaSet(x1 - t + 1, y0 + t, x1, mid - 1, color);
+            break;
+        case 2: //c
+            etft_AreaSet(x1 - t + 1, mid + t, x1, y1 - t, color);
+            break;
+        case 3: //d
+            etft_AreaSet(x0 + t, y1 - t + 1, x1 - t, y1, color);
+            break;
+        case 4: //e
+            etft_AreaSet(x0, mid + t, x0 + t - 1, y1 - t, color);
+            break;
+        case 5: //f
+            etft_AreaSet(x0, y0 + t, x0 + t - 1, mid - 1, color);
+            break;
+        case 6: //g
+            etft_AreaSet(x0 + t, mid, x1 - t, mid + t - 1, color);
+            break;
+    }
+}
+
+void etft_SegDigitInit(TftSegDigit* digit,
+                       uint16_t sx,
+                       uint16_t sy,
+                       uint16_t width,
+                       uint16_t height,
+                       uint16_t thick,
+                       uint16_t fRGB,
+                       uint16_t bRGB) {
+    //b、c、e、f段各至少1行，a、g、d段各至少1列，否则seg_Fill中的坐标会回绕
+    if (thick > width / 3)
+        thick = width / 3;
+    if (height < 2 || thick > (height - 2) / 3)
+        thick = height < 2 ? 0 : (height - 2) / 3;
+    digit->sx = sx;
+    digit->sy = sy;
+    digit->width = width;
+    digit->height = height;
+    digit->thick = thick;
+    digit->fRGB = fRGB;
+    digit->bRGB = bRGB;
+    digit->shown = SEG_REDRAW;
+}
+
+void etft_SegDigitSet(TftSegDigit* digit, uint8_t value) {
+    etft_SegDigitSetSegments(digit, value < sizeof(SEG_CTRL_BIN) ? SEG_CTRL_BIN[value] : 0x00);
+}
+
+void etft_SegDigitSetSegments(TftSegDigit* digit, uint8_t segments) {
+    uint8_t off, on, seg;
+
+    if (digit->thick == 0) //尺寸太小，不绘制
+        return;
+    segments &= 0x7F;
+    if (digit->shown & SEG_REDRAW) { //先清除整个数字区域
+        etft_AreaSet(digit->sx,
+                     digit->sy,
+                     digit->sx + digit->width - 1,
+                     digit->sy + digit->height - 1,
+                     digit->bRGB);
+        off = 0;
+        on = segments;
+    } else {
+        off = digit->shown & ~segments;
+        on = segments & ~digit->shown;
+    }
+    for (seg = 0; seg < 7; seg++) {
+        if (off & (1 << seg))
+            seg_Fill(digit, seg, digit->bRGB);
+        else if (on & (1 << seg))
+            seg_Fill(digit, seg, digit->fRGB);
+    }
+    digit->shown = segments;
+}
+
+void etft_SegDigitInvalidate(TftSegDigit* digit) {
+    digit->shown = SEG_REDRAW;
+}
@@ -0,0 +1,43 @@
+#ifndef __DR_TFT_SEG_H_
+#define __DR_TFT_SEG_H_
+
+#include "dr_tft.h"
+#include <stdint.h>
+
+/* TFT屏上的七段数码管大字 */
+/* 每段是一个纯色矩形，由etft_AreaSet绘制；更新时只擦除熄灭的段、填充点亮的段 */
+/* 段码与2-LCD/dr_lcdseg.c中的SEG_CTRL_BIN相同：位0~6依次为a~g段 */
+
+//SEG_CTRL_BIN中的特殊字符
+#define TFT_SEG_MINUS 16
+#define TFT_SEG_BLANK 0xFF
+
+typedef struct {
+    uint16_t sx, sy; //左上角
+    uint16_t width, height; //整个数字的宽高
+    uint16_t thick; //段的粗细
+    uint16_t fRGB, bRGB;
+    uint8_t shown; //屏幕上已点亮的段，最高位为1表示需要整体重绘
+} TftSegDigit;
+
+//初始化一位数字，此时不绘制，第一次etft_SegDigitSet时整体绘制
+//thick超过width/3或(height-2)/3时自动减小；width小于3或height小于5时放不下任何段，该数字不绘制
+void etft_SegDigitInit(TftSegDigit* digit,
+                       uint16_t sx,
+                       uint16_t sy,
+                       uint16_t width,
+                       uint16_t height,
+                       uint16_t thick,
+                       uint16_t fRGB,
+                       uint16_t bRGB);
+
+//显示SEG_CTRL_BIN中的第value个字符(0~F、-、S、J、T、U)，超出范围(如TFT_SEG_BLANK)时熄灭所有段
+void etft_SegDigitSet(TftSegDigit* digit, uint8_t value);
+
+//直接按段码显示，位0~6依次为a~g段
+void etft_SegDigitSetSegments(TftSegDigit* digit, uint8_t segments);
+
+//屏幕被其他绘图覆盖后调用，下一次更新时整体重绘
+void etft_SegDigitInvalidate(TftSegDigit* digit);
+
+#endif
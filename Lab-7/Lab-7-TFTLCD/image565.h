@@ -0,0 +1,531 @@
+#ifndef IMAGE_BEAR565_H
+#define IMAGE_BEAR565_H
+
+/*
+ * RGB565图像数据数组
+ * 图像尺寸: 64 × 64 像素
+ * 颜色格式: RGB565，每像素2字节，高字节在前
+ * 像素顺序: 从上到下、从左到右，行末无填充
+ * 总字节数: 8192 字节 (24位BGR需 12288 字节)
+ */
+
+#define IMAGE_BEAR565_WIDTH  64
+#define IMAGE_BEAR565_HEIGHT 64
+#define IMAGE_BEAR565_TOTAL_BYTES 8192
+
+const unsigned char image_bear565[8192] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0000
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0010
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0020
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0030
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0040
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0050
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0060
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0070
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0080
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0090
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x00A0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x00B0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x00C0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x00D0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x00E0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x00F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0100
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0110
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0120
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0130
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0140
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0150
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0160
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0170
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0180
+    0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0190
+    0x82, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x01A0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x01B0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x01C0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x01D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x01E0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x01F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0200
+    0x82, 0xC9, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0210
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0220
+    0x00, 0x00, 0x82, 0xA9, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xC9, 0x82, 0xC9,  // 偏移 0x0230
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0240
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0250
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0260
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0270
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xC9, 0x82, 0xCA,  // 偏移 0x0280
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0290
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xC9, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x02A0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x02B0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x02C0
+    0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x02D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x02E0
+    0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x02F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0300
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0310
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0320
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0330
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0340
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0350
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0360
+    0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0370
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0380
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xEA, 0x82, 0xEA, 0x82, 0xCA,  // 偏移 0x0390
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x03A0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x03B0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x03C0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x03D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x03E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x03F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0400
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x8B, 0x0A, 0x9B, 0xAC, 0xAC, 0x0D, 0xAC, 0x0D, 0x9B, 0xAC,  // 偏移 0x0410
+    0x8B, 0x0A, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0420
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0430
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0440
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xEA,  // 偏移 0x0450
+    0x8B, 0x2B, 0x9B, 0x8C, 0x9B, 0x8C, 0x93, 0x2B, 0x82, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0460
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0470
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0480
+    0x82, 0xCA, 0x82, 0xCA, 0x93, 0x2B, 0xB4, 0x4E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E,  // 偏移 0x0490
+    0xB4, 0x6E, 0x93, 0x6B, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x04A0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x04B0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x04C0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x8B, 0x2B, 0xAC, 0x2D,  // 偏移 0x04D0
+    0xB4, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xAC, 0x2D, 0x8B, 0x2B, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x04E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x04F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xC9, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0500
+    0x82, 0xCA, 0x8B, 0x0A, 0xB4, 0x4E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E,  // 偏移 0x0510
+    0xBC, 0x8E, 0xAC, 0x2D, 0x82, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0520
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0530
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0540
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xEA, 0xA3, 0xCC, 0xBC, 0x8E,  // 偏移 0x0550
+    0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xB4, 0x4E, 0x8B, 0x0A, 0x82, 0xCA,  // 偏移 0x0560
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0570
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0580
+    0x82, 0xCA, 0xA3, 0xCC, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E,  // 偏移 0x0590
+    0xAC, 0x2D, 0x8B, 0x0A, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x05A0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x05B0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x05C0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x8A, 0xEA, 0xA3, 0xCC,  // 偏移 0x05D0
+    0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xA3, 0xED, 0x82, 0xEA,  // 偏移 0x05E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x05F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0600
+    0x82, 0xEA, 0xAC, 0x0D, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xA3, 0xED,  // 偏移 0x0610
+    0x8A, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0620
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0630
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0640
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xEA,  // 偏移 0x0650
+    0x9B, 0x8C, 0xB4, 0x6E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xB4, 0x4E, 0x82, 0xEA,  // 偏移 0x0660
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0670
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0680
+    0x82, 0xEA, 0xAC, 0x0D, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xA3, 0xCC, 0x82, 0xEA,  // 偏移 0x0690
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x06A0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x06B0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x06C0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x06D0
+    0x82, 0xCA, 0x93, 0x6B, 0xB4, 0x6E, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xB4, 0x6E, 0x82, 0xEA,  // 偏移 0x06E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x06F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0700
+    0x82, 0xCA, 0xA3, 0xCC, 0xBC, 0x8E, 0xBC, 0x8E, 0xBC, 0x8E, 0xA3, 0xCC, 0x82, 0xEA, 0x82, 0xCA,  // 偏移 0x0710
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0720
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0730
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0740
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0750
+    0x82, 0xCA, 0x82, 0xCA, 0x93, 0x4B, 0xB4, 0x6E, 0xBC, 0x8E, 0xBC, 0x8E, 0xB4, 0x4E, 0x82, 0xEA,  // 偏移 0x0760
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0770
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0780
+    0x82, 0xCA, 0x93, 0x4B, 0xBC, 0x8E, 0xBC, 0x8E, 0xA3, 0xED, 0x82, 0xEA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0790
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x07A0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x07B0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x07C0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x07D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x93, 0x6B, 0xB4, 0x6E, 0xBC, 0x8E, 0xA3, 0xED, 0x82, 0xEA,  // 偏移 0x07E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x07F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0800
+    0x82, 0xCA, 0x82, 0xEA, 0xAC, 0x0D, 0xAC, 0x0D, 0x82, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0810
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0820
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0830
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0840
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0850
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x9B, 0x8C, 0xB4, 0x6E, 0x93, 0x4B, 0x82, 0xCA,  // 偏移 0x0860
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0870
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0880
+    0x82, 0xCA, 0x82, 0xCA, 0x8A, 0xEA, 0x82, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0890
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x08A0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x08B0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x08C0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x08D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xEA, 0x8B, 0x2B, 0x82, 0xEA, 0x82, 0xCA,  // 偏移 0x08E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x08F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0900
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0910
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0920
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0930
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0940
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0950
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0960
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0970
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0980
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0990
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x09A0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x09B0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x09C0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x09D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x09E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x09F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0A00
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0A10
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0A20
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0A30
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0A40
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0A50
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0A60
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0A70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0A80
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0A90
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0AA0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0AB0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0AC0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0AD0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0AE0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0AF0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xC9, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0B00
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0B10
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0B20
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0B30
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0B40
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0B50
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0B60
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0B70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0B80
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0B90
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0BA0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0BB0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0BC0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0BD0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0BE0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0BF0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0C00
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0C10
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0C20
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0C30
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0C40
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0C50
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0C60
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0C70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0C80
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0C90
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0CA0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0CB0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0CC0
+    0x82, 0xCA, 0x82, 0xCA, 0x7A, 0xA9, 0x7A, 0xA9, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0CD0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0CE0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0CF0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0D00
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0D10
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x5A, 0x07, 0x29, 0x04, 0x29, 0x03, 0x49, 0xA6, 0x7A, 0xA9,  // 偏移 0x0D20
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0D30
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0D40
+    0x7A, 0xA9, 0x49, 0xA6, 0x20, 0xE3, 0x20, 0xE3, 0x41, 0x85, 0x7A, 0x89, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0D50
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0D60
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0D70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0D80
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0D90
+    0x82, 0xCA, 0x82, 0xCA, 0x51, 0xE6, 0x18, 0xC2, 0x10, 0xA2, 0x10, 0xA2, 0x18, 0xA2, 0x49, 0xA6,  // 偏移 0x0DA0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0DB0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0DC0
+    0x51, 0xC6, 0x18, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x39, 0x65, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0DD0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0DE0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0DF0
+    0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0E00
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0E10
+    0x82, 0xCA, 0x7A, 0x89, 0x20, 0xE3, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x20, 0xE3,  // 偏移 0x0E20
+    0x7A, 0xA9, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0E30
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x7A, 0xA9,  // 偏移 0x0E40
+    0x20, 0xE3, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x18, 0xC3, 0x72, 0x68, 0x82, 0xCA,  // 偏移 0x0E50
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0E60
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0E70
+    0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0E80
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0E90
+    0x82, 0xCA, 0x6A, 0x48, 0x18, 0xC2, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x18, 0xC3,  // 偏移 0x0EA0
+    0x72, 0x68, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xEA, 0x8A, 0xEA,  // 偏移 0x0EB0
+    0x8A, 0xEA, 0x82, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x72, 0x89,  // 偏移 0x0EC0
+    0x18, 0xC3, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x18, 0xC2, 0x62, 0x27, 0x82, 0xCA,  // 偏移 0x0ED0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0EE0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0EF0
+    0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0F00
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0F10
+    0x82, 0xCA, 0x62, 0x48, 0x18, 0xC2, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x18, 0xC3,  // 偏移 0x0F20
+    0x72, 0x69, 0x82, 0xCA, 0x82, 0xCA, 0x8A, 0xEA, 0xA3, 0x6A, 0xC4, 0x0A, 0xD4, 0x6A, 0xDC, 0x8A,  // 偏移 0x0F30
+    0xDC, 0x8A, 0xD4, 0x6A, 0xC4, 0x2A, 0xA3, 0x6A, 0x8A, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x7A, 0x89,  // 偏移 0x0F40
+    0x20, 0xE3, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x18, 0xA2, 0x62, 0x27, 0x82, 0xCA,  // 偏移 0x0F50
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0F60
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0F70
+    0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0F80
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0F90
+    0x82, 0xCA, 0x72, 0x89, 0x20, 0xE3, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x29, 0x04,  // 偏移 0x0FA0
+    0x82, 0xC9, 0x82, 0xEA, 0xAB, 0xAA, 0xDC, 0xAA, 0xED, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x0FB0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xDC, 0x8A, 0xA3, 0x8A, 0x82, 0xEA, 0x82, 0xCA,  // 偏移 0x0FC0
+    0x41, 0x65, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x18, 0xC3, 0x6A, 0x48, 0x82, 0xCA,  // 偏移 0x0FD0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x0FE0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x0FF0
+    0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1000
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1010
+    0x82, 0xCA, 0x82, 0xCA, 0x51, 0xC6, 0x18, 0xC2, 0x10, 0xA2, 0x10, 0xA2, 0x18, 0xC3, 0x62, 0x27,  // 偏移 0x1020
+    0x8A, 0xEA, 0xCC, 0x2A, 0xED, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1030
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xEC, 0xEB, 0xC4, 0x0A, 0x8A, 0xEA,  // 偏移 0x1040
+    0x72, 0x89, 0x31, 0x24, 0x18, 0xC2, 0x10, 0xA2, 0x18, 0xA2, 0x41, 0x65, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1050
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1060
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1070
+    0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1080
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1090
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x62, 0x27, 0x41, 0x85, 0x49, 0xA5, 0x6A, 0x48, 0x8A, 0xEA,  // 偏移 0x10A0
+    0xD4, 0x6A, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xED, 0x0A, 0xED, 0x0A,  // 偏移 0x10B0
+    0xED, 0x0A, 0xED, 0x0A, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xCC, 0x2A,  // 偏移 0x10C0
+    0x8A, 0xEA, 0x7A, 0xA9, 0x62, 0x07, 0x49, 0xC6, 0x5A, 0x07, 0x7A, 0xA9, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x10D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x10E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xAA, 0x00, 0x00,  // 偏移 0x10F0
+    0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1100
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1110
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xEA, 0xCC, 0x2A,  // 偏移 0x1120
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0A, 0xCC, 0x49, 0x9B, 0x68, 0x72, 0xA7, 0x62, 0x47,  // 偏移 0x1130
+    0x62, 0x47, 0x6A, 0x87, 0x93, 0x28, 0xC4, 0x29, 0xED, 0x0A, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1140
+    0xBB, 0xEA, 0x82, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1150
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1160
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00,  // 偏移 0x1170
+    0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1180
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1190
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0xAB, 0xAA, 0xED, 0x0B,  // 偏移 0x11A0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xAB, 0xA8, 0x39, 0xA6, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86,  // 偏移 0x11B0
+    0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x39, 0xA6, 0x9B, 0x68, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x11C0
+    0xEC, 0xEB, 0xA3, 0x6A, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x11D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x11E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00,  // 偏移 0x11F0
+    0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1200
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1210
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x8A, 0xEA, 0xE4, 0xAA, 0xF5, 0x0B,  // 偏移 0x1220
+    0xF5, 0x0B, 0xF5, 0x0B, 0xE4, 0xCA, 0x49, 0xE6, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86,  // 偏移 0x1230
+    0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x41, 0xC6, 0xDC, 0xAA, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1240
+    0xF5, 0x0B, 0xDC, 0x8A, 0x8A, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1250
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1260
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00,  // 偏移 0x1270
+    0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1280
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1290
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0xB3, 0xCA, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x12A0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xCC, 0x49, 0x39, 0xA6, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86,  // 偏移 0x12B0
+    0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x31, 0x86, 0xC4, 0x29, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x12C0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xAB, 0xAA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x12D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x12E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00,  // 偏移 0x12F0
+    0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1300
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1310
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x8A, 0xEA, 0xD4, 0x8A, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1320
+    0xF5, 0x0B, 0xF5, 0x0B, 0xCC, 0x49, 0x39, 0xA6, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86,  // 偏移 0x1330
+    0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x31, 0xA6, 0xC4, 0x49, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1340
+    0xF5, 0x0B, 0xF5, 0x0B, 0xD4, 0x8A, 0x8A, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1350
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1360
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00,  // 偏移 0x1370
+    0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1380
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1390
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x93, 0x2A, 0xEC, 0xEB, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x13A0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xE4, 0xCA, 0x49, 0xE6, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86,  // 偏移 0x13B0
+    0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x41, 0xC6, 0xE4, 0xAA, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x13C0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xEC, 0xEB, 0x93, 0x2A, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x13D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x13E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00,  // 偏移 0x13F0
+    0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1400
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1410
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0xAB, 0xAA, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1420
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xA3, 0x88, 0x31, 0x86, 0x29, 0x86, 0x29, 0x86, 0x29, 0x86,  // 偏移 0x1430
+    0x29, 0x86, 0x29, 0x86, 0x29, 0x86, 0x31, 0x86, 0x93, 0x48, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1440
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xB3, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1450
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1460
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xAA, 0x00, 0x00,  // 偏移 0x1470
+    0x00, 0x00, 0x7A, 0xA9, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1480
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1490
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0xC4, 0x2A, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x14A0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xEC, 0xEA, 0x9B, 0x48, 0x41, 0xC6, 0x31, 0x86, 0x29, 0x86,  // 偏移 0x14B0
+    0x29, 0x86, 0x29, 0x86, 0x39, 0xA6, 0x8B, 0x07, 0xE4, 0xCA, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x14C0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xCC, 0x2A, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x14D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x14E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x14F0
+    0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1500
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1510
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xEA, 0xCC, 0x4A, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1520
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0A, 0xD4, 0x6A, 0xB3, 0xC8, 0x93, 0x48,  // 偏移 0x1530
+    0x93, 0x48, 0xAB, 0xA8, 0xCC, 0x49, 0xED, 0x0A, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1540
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xD4, 0x6A, 0x82, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1550
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1560
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1570
+    0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1580
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1590
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xEA, 0xCC, 0x4A, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x15A0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x15B0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x15C0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xD4, 0x6A, 0x82, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x15D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x15E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x15F0
+    0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1600
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1610
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0xCC, 0x4A, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1620
+    0xF5, 0x0B, 0xEC, 0xEA, 0xDC, 0xAA, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1630
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xE4, 0xCA, 0xEC, 0xEA, 0xF5, 0x0B,  // 偏移 0x1640
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xCC, 0x4A, 0x82, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1650
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1660
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1670
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1680
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1690
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0xBB, 0xEA, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x16A0
+    0xED, 0x0A, 0x83, 0x07, 0x49, 0xE6, 0xC4, 0x29, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x16B0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xC4, 0x29, 0x52, 0x06, 0x83, 0x07, 0xED, 0x0A,  // 偏移 0x16C0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xBB, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x16D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x16E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x16F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xAA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1700
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1710
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x9B, 0x4A, 0xED, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1720
+    0xF5, 0x0B, 0x9B, 0x68, 0x31, 0x86, 0x41, 0xC6, 0xAB, 0xA8, 0xEC, 0xEA, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1730
+    0xF5, 0x0B, 0xF5, 0x0B, 0xE4, 0xCA, 0xA3, 0xA8, 0x41, 0xC6, 0x31, 0x86, 0x9B, 0x48, 0xF5, 0x0B,  // 偏移 0x1740
+    0xF5, 0x0B, 0xF5, 0x0B, 0xED, 0x0B, 0x9B, 0x4A, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1750
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1760
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1770
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xAA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1780
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1790
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x8A, 0xEA, 0xD4, 0x8A, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x17A0
+    0xF5, 0x0B, 0xE4, 0xCA, 0x82, 0xE7, 0x31, 0x86, 0x31, 0x86, 0x62, 0x46, 0x9B, 0x48, 0xB3, 0xC8,  // 偏移 0x17B0
+    0xAB, 0xA8, 0x8B, 0x08, 0x52, 0x06, 0x31, 0x86, 0x31, 0x86, 0x82, 0xE7, 0xE4, 0xCA, 0xF5, 0x0B,  // 偏移 0x17C0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xD4, 0x8A, 0x8A, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x17D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x17E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x17F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xA9, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1800
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1810
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0xA3, 0x6A, 0xEC, 0xEB, 0xF5, 0x0B,  // 偏移 0x1820
+    0xF5, 0x0B, 0xF5, 0x0B, 0xEC, 0xEA, 0xB3, 0xC9, 0x5A, 0x26, 0x39, 0xA6, 0x31, 0x86, 0x29, 0x86,  // 偏移 0x1830
+    0x29, 0x86, 0x31, 0x86, 0x31, 0x86, 0x52, 0x06, 0xAB, 0xA8, 0xEC, 0xEA, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1840
+    0xF5, 0x0B, 0xEC, 0xEA, 0x9B, 0x4A, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1850
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1860
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1870
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1880
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1890
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0xAB, 0xAA, 0xEC, 0xEB,  // 偏移 0x18A0
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xEC, 0xEA, 0xCC, 0x49, 0xBB, 0xE9, 0xAB, 0xA8,  // 偏移 0x18B0
+    0xAB, 0x88, 0xB3, 0xC9, 0xC4, 0x29, 0xE4, 0xCA, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x18C0
+    0xEC, 0xCA, 0xAB, 0x8A, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x18D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x18E0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x18F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1900
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1910
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x9B, 0x4A,  // 偏移 0x1920
+    0xD4, 0x6A, 0xEC, 0xEB, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B,  // 偏移 0x1930
+    0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xF5, 0x0B, 0xEC, 0xEB, 0xD4, 0x6A,  // 偏移 0x1940
+    0x9B, 0x4A, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1950
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1960
+    0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1970
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xAA, 0x82, 0xCA,  // 偏移 0x1980
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1990
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x19A0
+    0x8A, 0xEA, 0x9B, 0x4A, 0xC4, 0x0A, 0xD4, 0x8A, 0xE4, 0xCA, 0xED, 0x0B, 0xED, 0x0B, 0xED, 0x0B,  // 偏移 0x19B0
+    0xED, 0x0B, 0xED, 0x0B, 0xEC, 0xEB, 0xE4, 0xCA, 0xD4, 0x6A, 0xBC, 0x0A, 0x9B, 0x4A, 0x82, 0xEA,  // 偏移 0x19C0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x19D0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x19E0
+    0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x19F0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xA9,  // 偏移 0x1A00
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1A10
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1A20
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x8A, 0xEA, 0x8A, 0xEA, 0x8B, 0x0A, 0x93, 0x2A, 0x9B, 0x4A,  // 偏移 0x1A30
+    0x9B, 0x4A, 0x93, 0x2A, 0x8B, 0x0A, 0x8A, 0xEA, 0x82, 0xEA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1A40
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1A50
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1A60
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1A70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1A80
+    0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1A90
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1AA0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1AB0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1AC0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1AD0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xAA, 0x00, 0x00,  // 偏移 0x1AE0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1AF0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1B00
+    0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1B10
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1B20
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1B30
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1B40
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1B50
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1B60
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1B70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1B80
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1B90
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1BA0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1BB0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1BC0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1BD0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1BE0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1BF0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1C00
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1C10
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1C20
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1C30
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1C40
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1C50
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1C60
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1C70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1C80
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xC9,  // 偏移 0x1C90
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1CA0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1CB0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1CC0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1CD0
+    0x82, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1CE0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1CF0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1D00
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1D10
+    0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1D20
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1D30
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1D40
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1D50
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1D60
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1D70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1D80
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1D90
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1DA0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1DB0
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1DC0
+    0x82, 0xC9, 0x82, 0xCA, 0x82, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1DD0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1DE0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1DF0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1E00
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1E10
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1E20
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xA9, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA,  // 偏移 0x1E30
+    0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1E40
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1E50
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1E60
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1E70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1E80
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1E90
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1EA0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1EB0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1EC0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1ED0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1EE0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1EF0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1F00
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1F10
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1F20
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1F30
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1F40
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1F50
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1F60
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1F70
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1F80
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1F90
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1FA0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1FB0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1FC0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1FD0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 偏移 0x1FE0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00  // 偏移 0x1FF0
+};
+
+#endif // IMAGE_BEAR565_H
@@ -114,6 +114,8 @@ SECTIONS
 //#else
 //    .const     : {} > FLASH              /* CONSTANT DATA                     */
 //#endif
+    .tftassets : {} > FLASH2             /* ASSET PACK FROM pack_assets.py    */
+    .tftassets_near : {} > FLASH         /* pack_assets.py --near             */
     .cio       : {} > RAM                /* C I/O BUFFER                      */
 
     .pinit     : {} > FLASH              /* C++ CONSTRUCTOR TABLES            */
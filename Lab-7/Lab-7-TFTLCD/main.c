@@ -2,10 +2,14 @@
  * main.c
  */
 #include "dr_tft.h"
-#include "image.h"
+#include "dr_tft_number.h"
+#include "image565.h"
 #include <msp430.h>
 #include <stdint.h>
-#include <stdio.h>
+
+#if TFT_USE_TIMING
+TftNumberField init_time_field; //显示initTFT耗时(ms)
+#endif
 
 void initClock() {
     while (BAKCTL & LOCKIO) // Unlock XT1 pins for operation
@@ -44,6 +48,9 @@ int main(void) {
     _EINT();
 
     etft_AreaSet(0, 0, 319, 239, 0);
+#if TFT_USE_TIMING
+    etft_NumberFieldInit(&init_time_field, 82, 210, 6, 1, 65504, 0);
+#endif
 
     while (1) {
         //etft_AreaSet(0, 0, 39, 239, 0);
@@ -63,7 +70,12 @@ int main(void) {
         etft_DisplayCustomCJK(index_array_names, 10, 10, 65535, 0);
         etft_DisplayCustomCJK(index_array_names, 10, 40, 65535, 31 );
         etft_DisplayCustomCJK(index_array_names, 10, 70, 0, 65535);
-        etft_DisplayImage(image_bear, 128, 120, 64, 64);
+        etft_DisplayImage565(image_bear565, 128, 120, IMAGE_BEAR565_WIDTH, IMAGE_BEAR565_HEIGHT);
+#if TFT_USE_TIMING
+        etft_DisplayString("INIT ms", 10, 210, 65535, 0);
+        etft_NumberFieldInvalidate(&init_time_field); //整屏刚被清除
+        etft_NumberFieldSet(&init_time_field, tft_InitTime() / 100);
+#endif
         __delay_cycles(MCLK_FREQ * 5);
     }
 }
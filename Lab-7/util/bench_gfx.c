@@ -0,0 +1,316 @@
+/*
+ * bench_gfx.c
+ *
+ * dr_tft_gfx图元的主机端基准测试，直接编译Lab-7-TFTLCD/dr_tft_gfx.c
+ *
+ * 用法:
+ *   cc -O2 -I../Lab-7-TFTLCD bench_gfx.c ../Lab-7-TFTLCD/dr_tft_gfx.c -o bench_gfx
+ *   ./bench_gfx
+ *
+ * etft_AreaSet与底层接口换成模拟实现：按窗口把像素写入320x240的帧缓冲，并统计SPI上传输的16位字数
+ * (每条寄存器指令为地址、数据两个字，RAM写入地址一个字，每像素一个字；窗口寄存器按
+ * TFT_SHADOW_REGS的影子副本规则省略重复写入)
+ * 每个图元及图像局部显示先与逐像素设置1x1窗口的参考画法比较帧缓冲确认结果一致，再比较两者的字数
+ */
+#include "dr_tft.h"
+#include "dr_tft_gfx.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define W TFT_YSIZE
+#define H TFT_XSIZE
+
+static uint16_t fb[H][W];
+static uint16_t win_x0, win_y0, win_x1, win_y1, cur_x, cur_y;
+static long words, windows;
+static uint16_t shadow[4];
+static int shadow_valid;
+
+//模拟tft_SendCmd的影子副本：窗口寄存器的值未变时不发送
+static void mock_Cmd(int idx, uint16_t value) {
+    if (idx >= 0) {
+        if ((shadow_valid & (1 << idx)) && shadow[idx] == value)
+            return;
+        shadow[idx] = value;
+        shadow_valid |= 1 << idx;
+    }
+    words += 2;
+}
+
+void tft_SetWindow(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY) {
+#if TFT_SHADOW_REGS
+    mock_Cmd(0, startX);
+    mock_Cmd(1, startY);
+    mock_Cmd(2, endX);
+    mock_Cmd(3, endY);
+#else
+    words += 8;
+#endif
+    words += 2 * 2 + 1; //RAM_XADDR、RAM_YADDR、RAM_ACCESS
+    windows++;
+    win_x0 = cur_x = startX;
+    win_y0 = cur_y = startY;
+    win_x1 = endX;
+    win_y1 = endY;
+}
+
+//写入一个像素，地址按X先增、到窗口右边后换行
+void tft_PushPixel(uint16_t color) {
+    if (cur_x < W && cur_y < H)
+        fb[cur_y][cur_x] = color;
+    words++;
+    if (++cur_x > win_x1) {
+        cur_x = win_x0;
+        cur_y++;
+    }
+}
+
+void tft_BeginPixels() {
+}
+
+void tft_EndPixels() {
+}
+
+void tft_PushPixelBytes(const uint8_t* data, uint32_t count) {
+    for (; count > 0; count--, data += 2)
+        tft_PushPixel((data[0] << 8) | data[1]);
+}
+
+#if TFT_USE_DMA
+void tft_DmaWrite(const uint8_t* data, uint32_t count, tft_DmaCallback callback) {
+    tft_PushPixelBytes(data, count);
+    if (callback)
+        callback();
+}
+
+void tft_DmaWait() {
+}
+#endif
+
+//与dr_tft2.c中相同：一个窗口，纯色填充(CPU或DMA发送的字数相同)
+void etft_AreaSet(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY, uint16_t color) {
+    uint32_t count = (uint32_t)(endX - startX + 1) * (endY - startY + 1);
+    tft_SetWindow(startX, startY, endX, endY);
+    while (count--)
+        tft_PushPixel(color);
+}
+
+/* 参考画法：每个像素单独设置1x1窗口 */
+
+static void ref_Pixel(int x, int y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= W || y >= H)
+        return;
+    tft_SetWindow(x, y, x, y);
+    tft_PushPixel(color);
+}
+
+static void ref_Line(int x0, int y0, int x1, int y1, uint16_t color) {
+    int dx = abs(x1 - x0), dy = -abs(y1 - y0);
+    int sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1, err = dx + dy, e2;
+    while (1) {
+        ref_Pixel(x0, y0, color);
+        if (x0 == x1 && y0 == y1)
+            break;
+        e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+static void ref_Rect(int x0, int y0, int x1, int y1, uint16_t color, int fill) {
+    int x, y;
+    for (y = y0; y <= y1; y++)
+        for (x = x0; x <= x1; x++)
+            if (fill || x == x0 || x == x1 || y == y0 || y == y1)
+                ref_Pixel(x, y, color);
+}
+
+static void ref_Circle(int cx, int cy, int r, uint16_t color, int fill) {
+    int x = 0, y = r, d = 1 - r, i;
+    while (x <= y) {
+        if (fill) {
+            for (i = -y; i <= y; i++) {
+                ref_Pixel(cx + i, cy + x, color);
+                ref_Pixel(cx + i, cy - x, color);
+            }
+            for (i = -x; i <= x; i++) {
+                ref_Pixel(cx + i, cy + y, color);
+                ref_Pixel(cx + i, cy - y, color);
+            }
+        } else {
+            ref_Pixel(cx + x, cy + y, color);
+            ref_Pixel(cx - x, cy + y, color);
+            ref_Pixel(cx + x, cy - y, color);
+            ref_Pixel(cx - x, cy - y, color);
+            ref_Pixel(cx + y, cy + x, color);
+            ref_Pixel(cx - y, cy + x, color);
+            ref_Pixel(cx + y, cy - x, color);
+            ref_Pixel(cx - y, cy - x, color);
+        }
+        if (d < 0) {
+            d += 2 * x + 3;
+        } else {
+            d += 2 * (x - y) + 5;
+            y--;
+        }
+        x++;
+    }
+}
+
+//测试用的64x48图像，两种格式内容相同
+#define IMG_W 64
+#define IMG_H 48
+static uint8_t img565[IMG_W * IMG_H * 2];
+static uint8_t img24[IMG_H][IMG_W * 3]; //每行192字节，已是4的整倍数
+
+static void make_images() {
+    int x, y;
+    for (y = 0; y < IMG_H; y++) {
+        for (x = 0; x < IMG_W; x++) {
+            uint8_t r = x * 4, g = y * 5, b = (x ^ y) * 4;
+            uint16_t c = etft_Color(r, g, b);
+            img565[(y * IMG_W + x) * 2] = c >> 8;
+            img565[(y * IMG_W + x) * 2 + 1] = c & 0xFF;
+            img24[y][x * 3] = b;
+            img24[y][x * 3 + 1] = g;
+            img24[y][x * 3 + 2] = r;
+        }
+    }
+}
+
+static void ref_Blit(int sx, int sy, int w, int h, int dx, int dy) {
+    int x, y;
+    for (y = 0; y < h; y++)
+        for (x = 0; x < w; x++)
+            if (sx + x < IMG_W && sy + y < IMG_H)
+                ref_Pixel(dx + x, dy + y, (img565[((sy + y) * IMG_W + sx + x) * 2] << 8) | img565[((sy + y) * IMG_W + sx + x) * 2 + 1]);
+}
+
+enum { P_HLINE, P_VLINE, P_RECT, P_FILLRECT, P_LINE, P_CIRCLE, P_FILLCIRCLE, P_BLIT565, P_BLIT24 };
+
+typedef struct {
+    const char* name;
+    int type;
+    int a, b, c, d, e, f;
+} Case;
+
+static const Case cases[] = {
+    { "hline 300", P_HLINE, 10, 309, 120, 0, 0, 0 },
+    { "vline 200", P_VLINE, 160, 20, 219, 0, 0, 0 },
+    { "rect 200x100", P_RECT, 60, 70, 259, 169, 0, 0 },
+    { "fillrect 200x100", P_FILLRECT, 60, 70, 259, 169, 0, 0 },
+    { "line shallow", P_LINE, 0, 0, 319, 40, 0, 0 },
+    { "line 45deg", P_LINE, 0, 0, 239, 239, 0, 0 },
+    { "line steep", P_LINE, 100, 0, 130, 239, 0, 0 },
+    { "line clipped", P_LINE, -100, -50, 400, 300, 0, 0 },
+    { "circle r=20", P_CIRCLE, 160, 120, 20, 0, 0, 0 },
+    { "circle r=100", P_CIRCLE, 160, 120, 100, 0, 0, 0 },
+    { "fillcircle r=20", P_FILLCIRCLE, 160, 120, 20, 0, 0, 0 },
+    { "fillcircle r=100", P_FILLCIRCLE, 160, 120, 100, 0, 0, 0 },
+    { "fillcircle clipped", P_FILLCIRCLE, 300, 10, 60, 0, 0, 0 },
+    { "blit565 full rows", P_BLIT565, 0, 8, 64, 16, 100, 100 },
+    { "blit565 sub-rect", P_BLIT565, 10, 8, 20, 16, 100, 100 },
+    { "blit565 clipped", P_BLIT565, 0, 0, 64, 48, -20, 210 },
+    { "blit24 clipped", P_BLIT24, 5, 5, 100, 100, 290, -10 },
+};
+
+static void run(const Case* c, int reference) {
+    const uint16_t color = 0xFFFF;
+    switch (c->type) {
+        case P_HLINE:
+            if (reference)
+                ref_Rect(c->a, c->c, c->b, c->c, color, 1);
+            else
+                etft_DrawHLine(c->a, c->b, c->c, color);
+            break;
+        case P_VLINE:
+            if (reference)
+                ref_Rect(c->a, c->b, c->a, c->c, color, 1);
+            else
+                etft_DrawVLine(c->a, c->b, c->c, color);
+            break;
+        case P_RECT:
+        case P_FILLRECT:
+            if (reference)
+                ref_Rect(c->a, c->b, c->c, c->d, color, c->type == P_FILLRECT);
+            else if (c->type == P_FILLRECT)
+                etft_FillRect(c->a, c->b, c->c, c->d, color);
+            else
+                etft_DrawRect(c->a, c->b, c->c, c->d, color);
+            break;
+        case P_LINE:
+            if (reference)
+                ref_Line(c->a, c->b, c->c, c->d, color);
+            else
+                etft_DrawLine(c->a, c->b, c->c, c->d, color);
+            break;
+        case P_CIRCLE:
+        case P_FILLCIRCLE:
+            if (reference)
+                ref_Circle(c->a, c->b, c->c, color, c->type == P_FILLCIRCLE);
+            else if (c->type == P_FILLCIRCLE)
+                etft_FillCircle(c->a, c->b, c->c, color);
+            else
+                etft_DrawCircle(c->a, c->b, c->c, color);
+            break;
+        case P_BLIT565:
+        case P_BLIT24:
+            if (reference)
+                ref_Blit(c->a, c->b, c->c, c->d, c->e, c->f);
+            else if (c->type == P_BLIT565)
+                etft_BlitImage565(img565, IMG_W, IMG_H, c->a, c->b, c->c, c->d, c->e, c->f);
+            else
+                etft_BlitImage(&img24[0][0], IMG_W, IMG_H, c->a, c->b, c->c, c->d, c->e, c->f);
+            break;
+    }
+}
+
+int main() {
+    static uint16_t expect[H][W];
+    unsigned i;
+    int failed = 0;
+
+    make_images();
+
+    printf("%-20s %8s %8s %10s %10s %7s\n", "primitive", "pixels", "windows", "SPI words", "per-pixel", "saving");
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        long ref_words, pixels = 0, x, y;
+
+        memset(fb, 0, sizeof(fb));
+        shadow_valid = 0;
+        words = windows = 0;
+        run(&cases[i], 1);
+        ref_words = words;
+        memcpy(expect, fb, sizeof(fb));
+
+        memset(fb, 0, sizeof(fb));
+        shadow_valid = 0;
+        words = windows = 0;
+        run(&cases[i], 0);
+
+        for (y = 0; y < H; y++)
+            for (x = 0; x < W; x++)
+                pixels += expect[y][x] != 0;
+        if (memcmp(fb, expect, sizeof(fb)) != 0) {
+            printf("%-20s MISMATCH against per-pixel reference\n", cases[i].name);
+            failed = 1;
+            continue;
+        }
+        printf("%-20s %8ld %8ld %10ld %10ld %6.1fx\n",
+               cases[i].name,
+               pixels,
+               windows,
+               words,
+               ref_words,
+               (double)ref_words / words);
+    }
+    printf("SPI_FREQ=%lu: %.1f us per 1000 words\n", (unsigned long)SPI_FREQ, 16.0 * 1000 / SPI_FREQ * 1e6);
+    return failed;
+}
@@ -0,0 +1,243 @@
+/*
+ * bench_qoi565.c
+ *
+ * QOI565解码器的主机端基准测试，直接编译Lab-7-TFTLCD/dr_tft_qoi.c中的解码器
+ *
+ * 用法:
+ *   python extract_bgr.py image.png -f qoibin -o image.q565
+ *   cc -O2 -I../Lab-7-TFTLCD bench_qoi565.c ../Lab-7-TFTLCD/dr_tft_qoi.c -o bench_qoi565
+ *   ./bench_qoi565 image.q565
+ *
+ * 先校验解码结果与原始RGB565逐字节一致，再统计各指令的占比、平均每像素的编码字节数与
+ * 主机上的解码吞吐量
+ *
+ * 主机吞吐量不能说明MSP430上的情况，因此再按下面的各指令周期数估算目标端每像素的MCLK周期数，
+ * 与SPI_FREQ下每像素的预算比较。周期数按tft_QoiDecode的C代码逐句对应MSP430X指令手工估算
+ * (寄存器间1周期，立即数/@Rn/@Rn+源2周期，x(Rn)源3周期，写x(Rn)4周期，跳转2周期)
+ * etft_DisplayImageQOI解码一块的同时DMA发送上一块，所以除平均值外还要看最慢的一块
+ *
+ * 板上实测: TFT_USE_TIMING为1时，在etft_DisplayImageQOI之后调用tft_PixelsPerSecond()，
+ * 与SPI_FREQ / 16比较即可
+ */
+#include "dr_tft.h"
+#include "dr_tft_qoi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CHUNK TFT_QOI_CHUNK
+
+/* 各指令解码的估算MCLK周期数，修改时同步修改extract_bgr.py中的QOI565_CYC_* */
+/* 每个像素都有写出5(SWPB 1 + 写x(Rn) 4) + 循环计数3，非RUN/RAW像素另有取指令字节2 */
+#define CYC_INDEX 20 //分派6 + 取索引表4
+#define CYC_DIFF 26 //分派10 + 加qoi_diff 4 + 跳回2
+#define CYC_LUMA 45 //分派14 + 查两张表10 + 写索引表9 + 跳回2
+#define CYC_RGB 43 //分派18 + 取2字节6 + 写索引表9
+#define CYC_RUN 54 //分派22 + 设置run 5 + 外层循环判断与分段27
+#define CYC_RUN16 60 //比RUN多取2字节
+#define CYC_RUN_PIXEL 8 //RUN的每个像素: 写出5 + 循环3
+#define CYC_RAW 68 //分派26 + 取长度3 + 外层循环判断与分段31 + 末像素作为px 8
+#define CYC_RAW_PIXEL 16 //逐字节复制2字节12 + 循环4
+/* 每块的函数调用、保存与恢复解码器状态、等待并启动DMA */
+#define CYC_CHUNK 200
+/* 有DMA时每传送1字节占用2个MCLK周期，每像素从CPU的预算中扣除4个 */
+#define CYC_DMA_STEAL 4
+
+/* etft_DisplayImageQOI用到的底层接口，主机上只需能链接 */
+void tft_SetWindow(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY) {
+    (void)startX;
+    (void)startY;
+    (void)endX;
+    (void)endY;
+}
+void tft_BeginPixels() {
+}
+void tft_EndPixels() {
+}
+void tft_PushPixelBytes(const uint8_t* data, uint32_t count) {
+    (void)data;
+    (void)count;
+}
+#if TFT_USE_DMA
+void tft_DmaWrite(const uint8_t* data, uint32_t count, tft_DmaCallback callback) {
+    (void)data;
+    (void)count;
+    (void)callback;
+}
+void tft_DmaWait() {
+}
+#endif
+
+static uint8_t* read_file(const char* path, long* size) {
+    FILE* f = fopen(path, "rb");
+    uint8_t* buf;
+    if (!f)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc(*size);
+    if (fread(buf, 1, *size, f) != (size_t)*size) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    return buf;
+}
+
+enum { OP_INDEX, OP_DIFF, OP_LUMA, OP_RGB, OP_RUN, OP_RUN16, OP_RAW, OP_COUNT };
+
+//按像素所在的块累加周期数
+static void add_cycles(double* chunk_cycles, uint32_t pixel, double cycles) {
+    chunk_cycles[pixel / CHUNK] += cycles;
+}
+
+//逐条解析编码数据，统计各指令出现的次数与覆盖的像素数，并把估算的周期数记到所在的块
+static void count_ops(const uint8_t* src, long len, long ops[OP_COUNT], long op_pixels[OP_COUNT], double* chunk_cycles) {
+    static const unsigned op_cycles[OP_COUNT] = { CYC_INDEX, CYC_DIFF, CYC_LUMA, CYC_RGB, CYC_RUN, CYC_RUN16, CYC_RAW };
+    const uint8_t* end = src + len;
+    uint32_t pixel = 0, n, i;
+    int kind;
+
+    while (src < end) {
+        uint8_t op = *src++;
+        n = 1;
+        if (op < 0x40) {
+            kind = OP_INDEX;
+        } else if (op < 0x80) {
+            kind = OP_DIFF;
+        } else if (op < 0xC0) {
+            kind = OP_LUMA;
+            src++;
+        } else if (op == 0xFE) {
+            kind = OP_RGB;
+            src += 2;
+        } else if (op < 0xFD) {
+            kind = OP_RUN;
+            n = (op & 0x3F) + 1;
+        } else if (op == 0xFD) {
+            kind = OP_RUN16;
+            n = ((src[0] << 8) | src[1]) + 1;
+            src += 2;
+        } else {
+            kind = OP_RAW;
+            n = *src + 1;
+            src += 1 + n * 2;
+        }
+        ops[kind]++;
+        op_pixels[kind] += n;
+        add_cycles(chunk_cycles, pixel, op_cycles[kind]);
+        if (kind >= OP_RUN) {
+            unsigned per_pixel = kind == OP_RAW ? CYC_RAW_PIXEL : CYC_RUN_PIXEL;
+            for (i = 0; i < n; i++)
+                add_cycles(chunk_cycles, pixel + i, per_pixel);
+        }
+        pixel += n;
+    }
+}
+
+int main(int argc, char** argv) {
+    static const char* op_names[OP_COUNT] = { "INDEX", "DIFF", "LUMA", "RGB", "RUN", "RUN16", "RAW" };
+    long size, ops[OP_COUNT] = { 0 }, op_pixels[OP_COUNT] = { 0 };
+    uint8_t* file;
+    const uint8_t *raw, *enc;
+    uint32_t pixels, done, rounds, r, chunks, worst_chunk = 0;
+    uint16_t width, height;
+    long enc_len;
+    static uint16_t out[CHUNK];
+    static TftQoiDecoder dec;
+    double* chunk_cycles;
+    clock_t start;
+    double seconds, pps, cycles = 0, per_pixel, worst = 0;
+    unsigned long spi_pps = SPI_FREQ / 16, steal = TFT_USE_DMA ? CYC_DMA_STEAL : 0;
+    unsigned long budget = MCLK_FREQ / spi_pps - steal;
+    int i;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s image.q565\n", argv[0]);
+        return 2;
+    }
+    file = read_file(argv[1], &size);
+    if (!file || size < 8 || memcmp(file, "Q565", 4) != 0) {
+        fprintf(stderr, "%s: not a Q565 bench file\n", argv[1]);
+        return 2;
+    }
+    width = (file[4] << 8) | file[5];
+    height = (file[6] << 8) | file[7];
+    pixels = (uint32_t)width * height;
+    raw = file + 8;
+    enc = raw + pixels * 2;
+    enc_len = size - 8 - (long)pixels * 2;
+
+    //校验
+    tft_QoiInit(&dec, enc);
+    for (done = 0; done < pixels; done += CHUNK) {
+        uint16_t n = pixels - done > CHUNK ? CHUNK : pixels - done;
+        tft_QoiDecode(&dec, out, n);
+        if (memcmp(out, raw + done * 2, n * 2) != 0) {
+            fprintf(stderr, "mismatch in pixels %u..%u\n", done, done + n - 1);
+            return 1;
+        }
+    }
+    if (dec.src != enc + enc_len) {
+        fprintf(stderr, "decoder consumed %ld of %ld bytes\n", (long)(dec.src - enc), enc_len);
+        return 1;
+    }
+
+    //计时，至少解码约1亿像素
+    rounds = 100000000 / pixels + 1;
+    start = clock();
+    for (r = 0; r < rounds; r++) {
+        tft_QoiInit(&dec, enc);
+        for (done = 0; done < pixels; done += CHUNK)
+            tft_QoiDecode(&dec, out, pixels - done > CHUNK ? CHUNK : pixels - done);
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    pps = (double)pixels * rounds / seconds;
+
+    chunks = (pixels + CHUNK - 1) / CHUNK;
+    chunk_cycles = calloc(chunks, sizeof(double));
+    count_ops(enc, enc_len, ops, op_pixels, chunk_cycles);
+    for (r = 0; r < chunks; r++) {
+        uint32_t n = r == chunks - 1 ? pixels - r * CHUNK : CHUNK;
+        double c = (chunk_cycles[r] + CYC_CHUNK) / n;
+        cycles += chunk_cycles[r] + CYC_CHUNK;
+        if (c > worst) {
+            worst = c;
+            worst_chunk = r;
+        }
+    }
+    per_pixel = cycles / pixels;
+    printf("image          %u x %u, %u pixels\n", width, height, pixels);
+    printf("encoded        %ld bytes (%.3f bytes/pixel, %.2f:1 vs RGB565)\n",
+           enc_len,
+           (double)enc_len / pixels,
+           (double)pixels * 2 / enc_len);
+    for (i = 0; i < OP_COUNT; i++)
+        printf("  %-6s       %ld ops, %ld pixels\n", op_names[i], ops[i], op_pixels[i]);
+    printf("decode         OK, %.1f Mpixel/s on host (not representative of MSP430)\n", pps / 1e6);
+    printf("SPI budget     %lu pixel/s at SPI_FREQ=%lu, %lu MCLK cycles/pixel for decoding at MCLK_FREQ=%lu%s\n",
+           spi_pps,
+           (unsigned long)SPI_FREQ,
+           budget,
+           (unsigned long)MCLK_FREQ,
+           TFT_USE_DMA ? " (after DMA cycle stealing)" : "");
+    printf("MSP430 est.    %.1f MCLK cycles/pixel average, %.1f in the slowest chunk (#%u of %u, %d pixels each)\n",
+           per_pixel,
+           worst,
+           worst_chunk,
+           chunks,
+           CHUNK);
+    if (worst <= budget)
+        printf("verdict        decoding keeps up with SPI (%.0f%% of budget on average, %.0f%% worst chunk)\n",
+               per_pixel * 100 / budget,
+               worst * 100 / budget);
+    else
+        printf("verdict        decode-bound, ~%.0f pixel/s = %.0f%% of the SPI rate\n",
+               MCLK_FREQ / (per_pixel + steal),
+               MCLK_FREQ / (per_pixel + steal) * 100 / spi_pps);
+    free(chunk_cycles);
+    free(file);
+    return 0;
+}
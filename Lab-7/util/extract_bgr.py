@@ -166,6 +166,503 @@ def save_as_c_header(bgr_data, info, output_path, array_name=None):
     except Exception as e:
         print(f"❌ 保存C头文件失败: {e}")
 
+def bgr_to_rgb565(bgr_array):
+    """
+    将BGR数组转换为RGB565，返回大端字节流(高字节在前，即SPI发送顺序)
+    像素顺序从上到下、从左到右，行末不填充
+    """
+    b = bgr_array[:, :, 0].astype(np.uint16)
+    g = bgr_array[:, :, 1].astype(np.uint16)
+    r = bgr_array[:, :, 2].astype(np.uint16)
+    rgb565 = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+    return rgb565.astype('>u2').tobytes()
+
+def write_c_byte_array(f, array_name, data):
+    """以每行16字节的格式写入C字节数组"""
+    f.write(f"const unsigned char {array_name}[{len(data)}] = {{\n")
+    for i in range(0, len(data), 16):  # 每行16个字节
+        line_data = data[i:i+16]
+        hex_values = [f"0x{byte:02X}" for byte in line_data]
+        f.write(f"    {', '.join(hex_values)}")
+        if i + 16 < len(data):
+            f.write(",")
+        f.write(f"  // 偏移 0x{i:04X}\n")
+    f.write("};\n\n")
+
+def default_array_name(output_path):
+    """从输出文件名生成数组名"""
+    base_name = os.path.splitext(os.path.basename(output_path))[0]
+    array_name = base_name.replace('-', '_').replace(' ', '_')
+    if not array_name.isidentifier():
+        array_name = "image_data"
+    return array_name
+
+def save_as_c_header_565(bgr_array, info, output_path, array_name=None):
+    """将图像保存为RGB565格式的C头文件，供etft_DisplayImage565使用"""
+    if array_name is None:
+        array_name = default_array_name(output_path)
+
+    data = bgr_to_rgb565(bgr_array)
+    try:
+        with open(output_path, 'w', encoding='utf-8') as f:
+            header_guard = f"{array_name.upper()}_H"
+            f.write(f"#ifndef {header_guard}\n")
+            f.write(f"#define {header_guard}\n\n")
+
+            f.write("/*\n")
+            f.write(" * RGB565图像数据数组\n")
+            f.write(f" * 图像尺寸: {info['width']} × {info['height']} 像素\n")
+            f.write(" * 颜色格式: RGB565，每像素2字节，高字节在前\n")
+            f.write(" * 像素顺序: 从上到下、从左到右，行末无填充\n")
+            f.write(f" * 总字节数: {len(data)} 字节 (24位BGR需 {info['total_bytes']} 字节)\n")
+            f.write(" */\n\n")
+
+            f.write(f"#define {array_name.upper()}_WIDTH  {info['width']}\n")
+            f.write(f"#define {array_name.upper()}_HEIGHT {info['height']}\n")
+            f.write(f"#define {array_name.upper()}_TOTAL_BYTES {len(data)}\n\n")
+
+            write_c_byte_array(f, array_name, data)
+            f.write(f"#endif // {header_guard}\n")
+
+        print(f"✅ RGB565 C头文件已保存到: {output_path}")
+        print(f"   数组名称: {array_name}")
+        print(f"   数组大小: {len(data)} 字节 (24位BGR为 {info['total_bytes']} 字节，"
+              f"节省 {100 - len(data) * 100 / info['total_bytes']:.1f}%)")
+
+    except Exception as e:
+        print(f"❌ 保存C头文件失败: {e}")
+
+def encode_rle565(rgb565_bytes):
+    """
+    将大端RGB565字节流按行程编码，格式与dr_tft2.c中etft_DisplayImageRLE一致:
+      0x00~0x7F: 其后跟n+1个原样像素(每个2字节)
+      0x80~0xBF: 其后跟1个颜色，重复(n&0x3F)+1次(1~64)
+      0xC0~0xFF: 再读1字节m，其后跟1个颜色，重复((n&0x3F)<<8|m)+1次(1~16384)
+    行程可以跨行，解码端按整幅图像连续展开
+    """
+    pixels = [rgb565_bytes[i:i+2] for i in range(0, len(rgb565_bytes), 2)]
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(p)
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < 16384 and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            flush_literal()
+            if run <= 64:
+                out.append(0x80 | (run - 1))
+            else:
+                out.append(0xC0 | ((run - 1) >> 8))
+                out.append((run - 1) & 0xFF)
+            out.extend(pixels[i])
+        else:
+            literal.append(pixels[i])
+        i += run
+    flush_literal()
+    return bytes(out)
+
+def save_as_c_header_rle(bgr_array, info, output_path, array_name=None):
+    """将图像保存为行程编码的RGB565 C头文件，供etft_DisplayImageRLE使用"""
+    if array_name is None:
+        array_name = default_array_name(output_path)
+
+    raw = bgr_to_rgb565(bgr_array)
+    data = encode_rle565(raw)
+    ratio = len(raw) / len(data)
+    try:
+        with open(output_path, 'w', encoding='utf-8') as f:
+            header_guard = f"{array_name.upper()}_H"
+            f.write(f"#ifndef {header_guard}\n")
+            f.write(f"#define {header_guard}\n\n")
+
+            f.write("/*\n")
+            f.write(" * 行程编码(RLE)的RGB565图像数据数组\n")
+            f.write(f" * 图像尺寸: {info['width']} × {info['height']} 像素\n")
+            f.write(" * 编码格式见extract_bgr.py中encode_rle565\n")
+            f.write(f" * 总字节数: {len(data)} 字节 (原始RGB565 {len(raw)} 字节，压缩比 {ratio:.2f}:1)\n")
+            f.write(" */\n\n")
+
+            f.write(f"#define {array_name.upper()}_WIDTH  {info['width']}\n")
+            f.write(f"#define {array_name.upper()}_HEIGHT {info['height']}\n")
+            f.write(f"#define {array_name.upper()}_TOTAL_BYTES {len(data)}\n\n")
+
+            write_c_byte_array(f, array_name, data)
+            f.write(f"#endif // {header_guard}\n")
+
+        print(f"✅ RLE C头文件已保存到: {output_path}")
+        print(f"   数组名称: {array_name}")
+        print(f"   数组大小: {len(data)} 字节 (原始RGB565 {len(raw)} 字节)")
+        print(f"   压缩比: {ratio:.2f}:1")
+
+    except Exception as e:
+        print(f"❌ 保存C头文件失败: {e}")
+
+def parse_key_color(text):
+    """将RRGGBB格式的颜色解析为RGB565"""
+    value = int(text.lstrip('#'), 16)
+    return rgb_to_565((value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF)
+
+def encode_sprite565(rgb565_bytes, width, height, key):
+    """
+    将大端RGB565字节流编码为透明色精灵，格式与dr_tft2.c中etft_DisplaySprite一致:
+      每行: 不透明段数n(1字节)，随后n段，每段为 x(2字节) 长度(2字节) 长度*2字节像素
+    x、长度均为大端，颜色等于key(RGB565)的像素为透明，不占用编码空间
+    """
+    pixels = [(rgb565_bytes[i] << 8) | rgb565_bytes[i + 1] for i in range(0, len(rgb565_bytes), 2)]
+    out = bytearray()
+    opaque = 0
+    for y in range(height):
+        row = pixels[y * width:(y + 1) * width]
+        runs = []
+        x = 0
+        while x < width:
+            if row[x] == key:
+                x += 1
+                continue
+            start = x
+            while x < width and row[x] != key:
+                x += 1
+            runs.append((start, x - start))
+        out.append(len(runs))
+        for start, length in runs:
+            out += bytes([start >> 8, start & 0xFF, length >> 8, length & 0xFF])
+            out += rgb565_bytes[(y * width + start) * 2:(y * width + start + length) * 2]
+            opaque += length
+    return bytes(out), opaque
+
+def save_as_c_header_sprite(bgr_array, info, output_path, array_name=None, key=None):
+    """将图像保存为透明色精灵的C头文件，供etft_DisplaySprite使用，key为None时取左上角像素的颜色"""
+    if array_name is None:
+        array_name = default_array_name(output_path)
+
+    raw = bgr_to_rgb565(bgr_array)
+    if key is None:
+        key = (raw[0] << 8) | raw[1]
+    data, opaque = encode_sprite565(raw, info['width'], info['height'], key)
+    total = info['width'] * info['height']
+    try:
+        with open(output_path, 'w', encoding='utf-8') as f:
+            header_guard = f"{array_name.upper()}_H"
+            f.write(f"#ifndef {header_guard}\n")
+            f.write(f"#define {header_guard}\n\n")
+
+            f.write("/*\n")
+            f.write(" * 透明色精灵(RGB565)\n")
+            f.write(f" * 图像尺寸: {info['width']} × {info['height']} 像素，透明色 0x{key:04X}\n")
+            f.write(" * 每行按不透明段编码，格式见extract_bgr.py中encode_sprite565\n")
+            f.write(f" * 不透明像素: {opaque} / {total}\n")
+            f.write(f" * 总字节数: {len(data)} 字节\n")
+            f.write(" */\n\n")
+
+            f.write(f"#define {array_name.upper()}_WIDTH  {info['width']}\n")
+            f.write(f"#define {array_name.upper()}_HEIGHT {info['height']}\n")
+            f.write(f"#define {array_name.upper()}_TOTAL_BYTES {len(data)}\n\n")
+
+            write_c_byte_array(f, array_name, data)
+            f.write(f"#endif // {header_guard}\n")
+
+        print(f"✅ 精灵C头文件已保存到: {output_path}")
+        print(f"   数组名称: {array_name}")
+        print(f"   透明色: 0x{key:04X}，不透明像素 {opaque} / {total}")
+        print(f"   数组大小: {len(data)} 字节")
+
+    except Exception as e:
+        print(f"❌ 保存C头文件失败: {e}")
+
+QOI565_OP_INDEX = 0x00  # 00xxxxxx
+QOI565_OP_DIFF = 0x40   # 01rrggbb
+QOI565_OP_LUMA = 0x80   # 10gggggg rrrrbbbb
+QOI565_OP_RUN = 0xC0    # 11xxxxxx，x为0~60
+QOI565_OP_RUN16 = 0xFD  # 11111101 高字节 低字节
+QOI565_OP_RGB = 0xFE    # 11111110 高字节 低字节
+QOI565_OP_RAW = 0xFF    # 11111111 n 之后n+1个大端RGB565像素
+
+# 解码器每次解码的像素数，与dr_tft_qoi.h中的TFT_QOI_CHUNK一致
+QOI565_CHUNK = 128
+# 各指令在MSP430上解码的估算MCLK周期数，与bench_qoi565.c中的CYC_*一致
+QOI565_CYC_INDEX = 20
+QOI565_CYC_DIFF = 26
+QOI565_CYC_LUMA = 45
+QOI565_CYC_RGB = 43
+QOI565_CYC_RUN = 54
+QOI565_CYC_RUN16 = 60
+QOI565_CYC_RUN_PIXEL = 8
+QOI565_CYC_RAW = 68
+QOI565_CYC_RAW_PIXEL = 16
+# 每块解码的周期预算: SPI 10MHz、MCLK 20MHz时每像素32周期，扣除DMA占用的4周期，
+# 再扣除每块的函数调用与DMA启动约200周期
+QOI565_CHUNK_BUDGET = (32 - 4) * QOI565_CHUNK - 200
+
+def qoi565_split(c):
+    return c >> 11, (c >> 5) & 0x3F, c & 0x1F
+
+def qoi565_hash(c):
+    return ((c >> 8) ^ c) & 63
+
+def qoi565_delta(prev, px):
+    """返回px相对prev的DIFF/LUMA编码，不能编码时返回None。分量不回绕，解码时可直接加到打包的RGB565上"""
+    pr, pg, pb = qoi565_split(prev)
+    r, g, b = qoi565_split(px)
+    dr, dg, db = r - pr, g - pg, b - pb
+    if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+        return bytes([QOI565_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2)])
+    half = dg // 2
+    if -32 <= dg <= 31 and -8 <= dr - half <= 7 and -8 <= db - half <= 7:
+        return bytes([QOI565_OP_LUMA | (dg + 32), ((dr - half + 8) << 4) | (db - half + 8)])
+    return None
+
+def qoi565_run(out, run):
+    if run <= 61:
+        out.append(QOI565_OP_RUN | (run - 1))
+    else:
+        out.append(QOI565_OP_RUN16)
+        out += (run - 1).to_bytes(2, 'big')
+
+def encode_qoi565(rgb565_bytes):
+    """
+    按QOI的思路对大端RGB565字节流编码，格式与dr_tft_qoi.c中的解码器一致:
+      00xxxxxx          INDEX: 取64项颜色索引表中的第x项
+      01rrggbb          DIFF : 与前一像素的分量差，各为-2~1(偏置2)，r、b以5位计，g以6位计
+      10gggggg rrrrbbbb LUMA : dg为-32~31(偏置32)，dr-dg/2与db-dg/2为-8~7(偏置8)，dg/2向下取整
+      11xxxxxx          RUN  : 重复前一像素x+1次(1~61)
+      11111101 hi lo    RUN16: 重复前一像素(hi<<8|lo)+1次
+      11111110 hi lo    RGB  : 原样的RGB565颜色
+      11111111 n ...    RAW  : 之后n+1个原样的大端RGB565像素
+    前一像素初始为0，索引表初始全为0，哈希为(c>>8 ^ c)%64
+    DIFF/LUMA只在各分量都不回绕时使用，解码时可把差值直接加到打包的RGB565上
+    索引表只在LUMA与RGB时更新，DIFF、INDEX、RUN与RAW都不更新
+
+    解码要跟上SPI，编码时按解码器的分块逐块估算解码周期数，超出QOI565_CHUNK_BUDGET的块
+    保留预算内最长的前段，其余像素改用RAW，因此任何图像的每一块都不会拖慢SPI，代价是这些像素不压缩
+    """
+    pixels = [(rgb565_bytes[i] << 8) | rgb565_bytes[i + 1] for i in range(0, len(rgb565_bytes), 2)]
+    out = bytearray()
+    index = [0] * 64
+    prev = 0
+    run = 0
+
+    for start in range(0, len(pixels), QOI565_CHUNK):
+        chunk = pixels[start:start + QOI565_CHUNK]
+        # 每个像素编码前的状态，用于退回到块内任意位置: (输出长度, 周期数, 索引表改动数, prev, run)
+        marks = []
+        changes = []
+        cycles = 0
+        for px in chunk:
+            marks.append((len(out), cycles, len(changes), prev, run))
+            if px == prev:
+                if run == 0:
+                    cycles += QOI565_CYC_RUN16
+                cycles += QOI565_CYC_RUN_PIXEL
+                run += 1
+                if run == 65535:
+                    qoi565_run(out, run)
+                    run = 0
+                continue
+            if run > 0:
+                qoi565_run(out, run)
+                run = 0
+
+            h = qoi565_hash(px)
+            if index[h] == px:
+                out.append(QOI565_OP_INDEX | h)
+                cycles += QOI565_CYC_INDEX
+            else:
+                delta = qoi565_delta(prev, px)
+                if delta is not None and len(delta) == 1:
+                    cycles += QOI565_CYC_DIFF
+                else:
+                    changes.append((h, index[h]))
+                    index[h] = px
+                    if delta is not None:
+                        cycles += QOI565_CYC_LUMA
+                    else:
+                        delta = bytes([QOI565_OP_RGB, px >> 8, px & 0xFF])
+                        cycles += QOI565_CYC_RGB
+                out += delta
+            prev = px
+
+        if cycles <= QOI565_CHUNK_BUDGET:
+            continue
+        # 找出剩余像素改用RAW后仍在预算内的最长前段，退回到该处
+        keep = len(chunk) - 1
+        while marks[keep][1] + QOI565_CYC_RAW + QOI565_CYC_RAW_PIXEL * (len(chunk) - keep) > QOI565_CHUNK_BUDGET:
+            keep -= 1
+        size, cycles, changed, prev, run = marks[keep]
+        del out[size:]
+        while len(changes) > changed:
+            h, old = changes.pop()
+            index[h] = old
+        if run > 0:
+            qoi565_run(out, run)
+            run = 0
+        out.append(QOI565_OP_RAW)
+        out.append(len(chunk) - keep - 1)
+        for px in chunk[keep:]:
+            out.append(px >> 8)
+            out.append(px & 0xFF)
+        prev = chunk[-1]
+
+    if run > 0:
+        qoi565_run(out, run)
+    return bytes(out)
+
+def save_as_c_header_qoi(bgr_array, info, output_path, array_name=None):
+    """将图像保存为QOI565编码的C头文件，供etft_DisplayImageQOI使用"""
+    if array_name is None:
+        array_name = default_array_name(output_path)
+
+    raw = bgr_to_rgb565(bgr_array)
+    data = encode_qoi565(raw)
+    ratio = len(raw) / len(data)
+    try:
+        with open(output_path, 'w', encoding='utf-8') as f:
+            header_guard = f"{array_name.upper()}_H"
+            f.write(f"#ifndef {header_guard}\n")
+            f.write(f"#define {header_guard}\n\n")
+
+            f.write("/*\n")
+            f.write(" * QOI565编码的图像数据数组\n")
+            f.write(f" * 图像尺寸: {info['width']} × {info['height']} 像素\n")
+            f.write(" * 编码格式见extract_bgr.py中encode_qoi565\n")
+            f.write(f" * 总字节数: {len(data)} 字节 (原始RGB565 {len(raw)} 字节，压缩比 {ratio:.2f}:1)\n")
+            f.write(" */\n\n")
+
+            f.write(f"#define {array_name.upper()}_WIDTH  {info['width']}\n")
+            f.write(f"#define {array_name.upper()}_HEIGHT {info['height']}\n")
+            f.write(f"#define {array_name.upper()}_TOTAL_BYTES {len(data)}\n\n")
+
+            write_c_byte_array(f, array_name, data)
+            f.write(f"#endif // {header_guard}\n")
+
+        print(f"✅ QOI565 C头文件已保存到: {output_path}")
+        print(f"   数组名称: {array_name}")
+        print(f"   数组大小: {len(data)} 字节 (原始RGB565 {len(raw)} 字节)")
+        print(f"   压缩比: {ratio:.2f}:1")
+
+    except Exception as e:
+        print(f"❌ 保存C头文件失败: {e}")
+
+def save_qoi_bench_file(bgr_array, info, output_path):
+    """
+    保存供bench_qoi565使用的测试文件:
+    'Q565' + 宽(2字节) + 高(2字节) + 原始RGB565 + QOI565编码数据，整数均为大端
+    """
+    raw = bgr_to_rgb565(bgr_array)
+    data = encode_qoi565(raw)
+    try:
+        with open(output_path, 'wb') as f:
+            f.write(b'Q565')
+            f.write(info['width'].to_bytes(2, 'big'))
+            f.write(info['height'].to_bytes(2, 'big'))
+            f.write(raw)
+            f.write(data)
+        print(f"✅ QOI565测试文件已保存到: {output_path}")
+        print(f"   压缩比: {len(raw) / len(data):.2f}:1")
+    except Exception as e:
+        print(f"❌ 保存文件失败: {e}")
+
+def rgb_to_565(r, g, b):
+    """单个RGB颜色转换为RGB565，与dr_tft.h中etft_Color一致"""
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+def quantize_indexed(bgr_array, bpp, dither=False):
+    """
+    将图像量化为2^bpp色，返回(索引数组, RGB565调色板列表)
+    换算为RGB565后颜色数本来就不超过2^bpp时不做抖动，直接以这些颜色为调色板逐像素精确对应
+    """
+    colors = 1 << bpp
+    b = bgr_array[:, :, 0].astype(np.uint16)
+    g = bgr_array[:, :, 1].astype(np.uint16)
+    r = bgr_array[:, :, 2].astype(np.uint16)
+    rgb565 = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+    unique = np.unique(rgb565)
+    if len(unique) <= colors:
+        indices = np.searchsorted(unique, rgb565).astype(np.uint8)
+        palette = [int(c) for c in unique] + [0] * (colors - len(unique))
+        return indices, palette
+
+    img = Image.fromarray(np.ascontiguousarray(bgr_array[:, :, ::-1]))
+    dither_mode = Image.Dither.FLOYDSTEINBERG if dither else Image.Dither.NONE
+    quantized = img.quantize(colors=colors, dither=dither_mode)
+    indices = np.array(quantized, dtype=np.uint8)
+    pal = quantized.getpalette()[:colors * 3]
+    pal += [0] * (colors * 3 - len(pal))
+    palette = [rgb_to_565(pal[i], pal[i + 1], pal[i + 2]) for i in range(0, colors * 3, 3)]
+    return indices, palette
+
+def pack_indices(indices, bpp):
+    """按bpp位打包索引，每字节高位在前，每行从新的字节开始"""
+    height, width = indices.shape
+    per_byte = 8 // bpp
+    out = bytearray()
+    for y in range(height):
+        for x0 in range(0, width, per_byte):
+            byte = 0
+            for k in range(per_byte):
+                x = x0 + k
+                value = int(indices[y, x]) if x < width else 0
+                byte |= value << (8 - bpp * (k + 1))
+            out.append(byte)
+    return bytes(out)
+
+def save_as_c_header_indexed(bgr_array, info, output_path, array_name=None, bpp=4, dither=False):
+    """将图像保存为调色板索引格式的C头文件，供etft_DisplayImageIndexed使用"""
+    if array_name is None:
+        array_name = default_array_name(output_path)
+
+    indices, palette = quantize_indexed(bgr_array, bpp, dither)
+    data = pack_indices(indices, bpp)
+    raw_bytes = info['width'] * info['height'] * 2
+    total = len(data) + len(palette) * 2
+    try:
+        with open(output_path, 'w', encoding='utf-8') as f:
+            header_guard = f"{array_name.upper()}_H"
+            f.write(f"#ifndef {header_guard}\n")
+            f.write(f"#define {header_guard}\n\n")
+            f.write('#include "dr_tft.h"\n\n')
+
+            f.write("/*\n")
+            f.write(f" * {bpp}位调色板索引图像\n")
+            f.write(f" * 图像尺寸: {info['width']} × {info['height']} 像素\n")
+            f.write(f" * 索引按行打包，每字节高位在前，每行从新字节开始，调色板为{len(palette)}项RGB565\n")
+            f.write(f" * 抖动: {'Floyd-Steinberg' if dither else '无'}\n")
+            f.write(f" * 总字节数: {total} 字节 (RGB565需 {raw_bytes} 字节)\n")
+            f.write(" */\n\n")
+
+            f.write(f"#define {array_name.upper()}_WIDTH  {info['width']}\n")
+            f.write(f"#define {array_name.upper()}_HEIGHT {info['height']}\n")
+            f.write(f"#define {array_name.upper()}_BPP {bpp}\n\n")
+
+            f.write(f"const uint16_t {array_name}_palette[{len(palette)}] = {{\n")
+            for i in range(0, len(palette), 8):
+                f.write("    " + ", ".join(f"0x{c:04X}" for c in palette[i:i+8]))
+                f.write(",\n" if i + 8 < len(palette) else "\n")
+            f.write("};\n\n")
+
+            write_c_byte_array(f, f"{array_name}_data", data)
+
+            f.write(f"const TftIndexedImage {array_name} = {{\n")
+            f.write(f"    {info['width']}, {info['height']}, {bpp}, {array_name}_data, {array_name}_palette\n")
+            f.write("};\n\n")
+            f.write(f"#endif // {header_guard}\n")
+
+        print(f"✅ 索引图像C头文件已保存到: {output_path}")
+        print(f"   名称: {array_name}")
+        print(f"   {bpp}位索引 {len(data)} 字节 + 调色板 {len(palette) * 2} 字节 (RGB565为 {raw_bytes} 字节)")
+
+    except Exception as e:
+        print(f"❌ 保存C头文件失败: {e}")
+
 def save_bgr_data(bgr_data, bgr_array, info, output_path, format_type='npy'):
     """保存BGR数据到文件"""
     try:
@@ -229,8 +726,15 @@ def main():
     parser = argparse.ArgumentParser(description='从图像提取BGR数组数据并导出为C头文件')
     parser.add_argument('input', nargs='?', help='输入图像文件路径')
     parser.add_argument('-o', '--output', help='输出文件路径')
-    parser.add_argument('-f', '--format', choices=['npy', 'csv', 'txt', 'bin', 'c'], 
-                       default='c', help='输出格式 (默认: c)')
+    parser.add_argument('-f', '--format', choices=['npy', 'csv', 'txt', 'bin', 'c', 'c565', 'rle', 'qoi', 'qoibin', 'indexed', 'sprite'],
+                       default='c',
+                       help='输出格式 (默认: c；c565为RGB565 C头文件，rle为行程编码的RGB565 C头文件，'
+                            'qoi为QOI565编码的C头文件，qoibin为bench_qoi565的测试文件，'
+                            'indexed为调色板索引图像的C头文件，sprite为透明色精灵的C头文件)')
+    parser.add_argument('--bpp', type=int, choices=[1, 2, 4, 8], default=4,
+                       help='indexed格式每像素的位数 (默认: 4)')
+    parser.add_argument('--dither', action='store_true', help='indexed格式量化时使用Floyd-Steinberg抖动')
+    parser.add_argument('--key', help='sprite格式的透明色，RRGGBB格式 (默认: 左上角像素的颜色)')
     parser.add_argument('--array-name', help='C头文件中的数组名称')
     parser.add_argument('--no-analysis', action='store_true', help='跳过数组分析报告')
     parser.add_argument('--pixel', nargs=2, type=int, metavar=('X', 'Y'), 
@@ -250,12 +754,12 @@ def main():
         
         output_path = input("请输入输出文件路径 (留空则自动生成): ").strip().strip('"')
         
-        format_choice = input("选择输出格式 [c/npy/csv/txt/bin] (默认: c): ").strip().lower()
+        format_choice = input("选择输出格式 [c/c565/rle/qoi/qoibin/indexed/sprite/npy/csv/txt/bin] (默认: c): ").strip().lower()
         if not format_choice:
             format_choice = 'c'
         
         array_name = None
-        if format_choice == 'c':
+        if format_choice in ('c', 'c565', 'rle', 'qoi', 'indexed', 'sprite'):
             array_name = input("请输入C数组名称 (留空则自动生成): ").strip()
     else:
         image_path = args.input
@@ -291,12 +795,37 @@ def main():
             base_name = os.path.splitext(os.path.basename(image_path))[0]
             if format_choice == 'c':
                 output_path = f"{base_name}_bgr.h"
+            elif format_choice == 'c565':
+                output_path = f"{base_name}_565.h"
+            elif format_choice == 'rle':
+                output_path = f"{base_name}_rle.h"
+            elif format_choice == 'qoi':
+                output_path = f"{base_name}_qoi.h"
+            elif format_choice == 'qoibin':
+                output_path = f"{base_name}.q565"
+            elif format_choice == 'indexed':
+                output_path = f"{base_name}_idx.h"
+            elif format_choice == 'sprite':
+                output_path = f"{base_name}_sprite.h"
             else:
                 extensions = {'npy': '.npy', 'csv': '.csv', 'txt': '.txt', 'bin': '.bin'}
                 output_path = f"{base_name}_bgr{extensions[format_choice]}"
         
         if format_choice == 'c':
             save_as_c_header(bgr_data, info, output_path, array_name)
+        elif format_choice == 'c565':
+            save_as_c_header_565(bgr_array, info, output_path, array_name)
+        elif format_choice == 'rle':
+            save_as_c_header_rle(bgr_array, info, output_path, array_name)
+        elif format_choice == 'qoi':
+            save_as_c_header_qoi(bgr_array, info, output_path, array_name)
+        elif format_choice == 'qoibin':
+            save_qoi_bench_file(bgr_array, info, output_path)
+        elif format_choice == 'indexed':
+            save_as_c_header_indexed(bgr_array, info, output_path, array_name, args.bpp, args.dither)
+        elif format_choice == 'sprite':
+            key = parse_key_color(args.key) if args.key else None
+            save_as_c_header_sprite(bgr_array, info, output_path, array_name, key)
         else:
             save_bgr_data(bgr_data, bgr_array, info, output_path, format_choice)
 
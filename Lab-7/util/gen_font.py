@@ -0,0 +1,308 @@
+# 点阵字库生成工具：从BDF/TTF字体中只提取字符串实际用到的字形，导出供etft_DisplayUTF8使用的C头文件
+# 每像素1位，或从TTF按指定像素大小渲染为每像素2位的4级灰度(抗锯齿)
+# 加--cells时把现有的整格字模C数组(如tft_ascii、tft_cjk_bitmap)转换为TftFont，字形序号即码位
+import argparse
+import os
+import re
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+# C字符串字面量，含u8前缀与转义字符
+C_STRING_RE = re.compile(r'(?:u8)?"((?:[^"\\\n]|\\.)*)"')
+
+def collect_chars(paths, text, include_ascii):
+    """收集源文件中字符串字面量里出现的字符以及--text给出的字符，默认只保留非ASCII字符"""
+    chars = set(text or '')
+    for path in paths:
+        with open(path, encoding='utf-8', errors='replace') as f:
+            for literal in C_STRING_RE.findall(f.read()):
+                chars.update(literal)
+    if include_ascii:
+        chars.update(chr(c) for c in range(0x20, 0x7F))
+    chars = {c for c in chars if (include_ascii or ord(c) >= 0x80) and ord(c) <= 0xFFFE and c != '�'}
+    return sorted(chars)
+
+class BdfFont:
+    """BDF点阵字体，字形按FONT_ASCENT对齐基线后放入width x height的格子"""
+
+    def __init__(self, path):
+        self.glyphs = {}
+        self.ascent = None
+        with open(path, encoding='latin-1') as f:
+            lines = iter(f.read().splitlines())
+        for line in lines:
+            if line.startswith('FONT_ASCENT'):
+                self.ascent = int(line.split()[1])
+            elif line.startswith('FONTBOUNDINGBOX') and self.ascent is None:
+                _, w, h, xoff, yoff = line.split()
+                self.ascent = int(h) + int(yoff)
+            elif line.startswith('STARTCHAR'):
+                self._read_char(lines)
+
+    def _read_char(self, lines):
+        code, bbx, rows = None, None, []
+        for line in lines:
+            if line.startswith('ENCODING'):
+                code = int(line.split()[1])
+            elif line.startswith('BBX'):
+                bbx = [int(v) for v in line.split()[1:5]]
+            elif line == 'BITMAP':
+                for line in lines:
+                    if line == 'ENDCHAR':
+                        break
+                    rows.append(int(line, 16))
+                break
+        if code is not None and code >= 0 and bbx is not None:
+            self.glyphs[code] = (bbx, rows)
+
+    def render(self, ch, width, height, threshold=128, bpp=1):
+        """返回height行、每行width个像素值的列表，字体中没有该字符时返回None
+        BDF只有两级，bpp为2时墨迹取最深的3"""
+        if ord(ch) not in self.glyphs:
+            return None
+        (w, h, xoff, yoff), rows = self.glyphs[ord(ch)]
+        row_bits = ((w + 7) // 8) * 8
+        top = self.ascent - (yoff + h)
+        ink = (1 << bpp) - 1
+        cell = [[0] * width for _ in range(height)]
+        for y, bits in enumerate(rows[:h]):
+            for x in range(w):
+                cx, cy = xoff + x, top + y
+                if 0 <= cx < width and 0 <= cy < height and (bits >> (row_bits - 1 - x)) & 1:
+                    cell[cy][cx] = ink
+        return cell
+
+class TtfFont:
+    """TrueType/OpenType字体，按size像素渲染，字形在格子中水平居中，基线按字体的ascent/descent比例放置"""
+
+    def __init__(self, path, size):
+        self.font = ImageFont.truetype(path, size)
+        self.ascent, self.descent = self.font.getmetrics()
+
+    def render_gray(self, ch, width, height):
+        """返回height行、每行width个0~255灰度的列表，字体中没有该字符时返回None"""
+        if not self.has_glyph(ch):
+            return None
+        img = Image.new('L', (width, height), 0)
+        draw = ImageDraw.Draw(img)
+        advance = self.font.getlength(ch)
+        baseline = round(height * self.ascent / (self.ascent + self.descent))
+        draw.text(((width - advance) / 2, baseline), ch, fill=255, font=self.font, anchor='ls')
+        px = img.load()
+        return [[px[x, y] for x in range(width)] for y in range(height)]
+
+    def render(self, ch, width, height, threshold=128, bpp=1):
+        """bpp为1时按threshold二值化，为2时灰度量化为0~3四级"""
+        gray = self.render_gray(ch, width, height)
+        if gray is None:
+            return None
+        if bpp == 2:
+            return [[(v * 3 + 127) // 255 for v in row] for row in gray]
+        return [[1 if v >= threshold else 0 for v in row] for row in gray]
+
+    def has_glyph(self, ch):
+        # 缺字时FreeType返回.notdef，其掩码与一个肯定不存在的私用区字符相同
+        mask = self.font.getmask(ch)
+        notdef = self.font.getmask('\U0010FFFD')
+        return ch == ' ' or mask.size != notdef.size or bytes(mask) != bytes(notdef)
+
+class CellArray:
+    """整格字模的C数组，每个字形height行，每行(width+7)/8字节，高位在左，如dr_tft_ascii.h"""
+
+    def __init__(self, path, width, height):
+        with open(path, encoding='utf-8', errors='replace') as f:
+            text = re.sub(r'/\*.*?\*/', '', f.read(), flags=re.S)
+        text = text[text.index('{') + 1:]
+        size = (width + 7) // 8 * height
+        data, self.labels = [], []
+        # 数组中的注释写在字形之后，恰好在字形结束处的注释作为该字形的说明
+        for token in re.finditer(r'0[xX]([0-9A-Fa-f]{1,2})|//([^\n]*)', text):
+            if token.group(1):
+                data.append(int(token.group(1), 16))
+            elif len(data) % size == 0 and len(self.labels) < len(data) // size:
+                self.labels += [''] * (len(data) // size - 1 - len(self.labels))
+                self.labels.append(token.group(2).strip())
+        if not data or len(data) % size:
+            raise ValueError(f"{path}: 数组长度{len(data)}不是每个字形{size}字节的整数倍")
+        self.labels += [''] * (len(data) // size - len(self.labels))
+        self.cells = []
+        stride = (width + 7) // 8
+        for i in range(0, len(data), size):
+            glyph = data[i:i + size]
+            self.cells.append([[(glyph[y * stride + x // 8] >> (7 - x % 8)) & 1 for x in range(width)]
+                               for y in range(height)])
+
+def open_font(path, size):
+    if path.lower().endswith('.bdf'):
+        return BdfFont(path)
+    return TtfFont(path, size)
+
+class BitPacker:
+    """按高位在前连续写入bpp位的像素值"""
+
+    def __init__(self, bpp):
+        self.bpp = bpp
+        self.out = bytearray()
+        self.byte, self.nbits = 0, 0
+
+    def put(self, v):
+        self.byte = (self.byte << self.bpp) | v
+        self.nbits += self.bpp
+        if self.nbits == 8:
+            self.flush()
+
+    def flush(self):
+        """不足一字节的部分左对齐补0"""
+        if self.nbits:
+            self.out.append((self.byte << (8 - self.nbits)) & 0xFF)
+            self.byte, self.nbits = 0, 0
+
+def pack_glyph(cell, width, bpp=1):
+    """整格格式：每行(width*bpp+7)/8字节，高位在左，与dr_tft_font.c一致"""
+    packer = BitPacker(bpp)
+    for row in cell:
+        for v in row[:width]:
+            packer.put(v)
+        packer.flush()
+    return bytes(packer.out)
+
+def ink_bbox(cell):
+    """返回墨迹的包围盒(x0, y0, w, h)，空白字形返回(0, 0, 0, 0)"""
+    rows = [y for y, row in enumerate(cell) if any(row)]
+    cols = [x for x in range(len(cell[0])) if any(row[x] for row in cell)]
+    if not rows:
+        return 0, 0, 0, 0
+    return cols[0], rows[0], cols[-1] - cols[0] + 1, rows[-1] - rows[0] + 1
+
+def pack_glyph_bbox(cell, bpp=1):
+    """包围盒格式：x0 y0 w h各1字节，随后w*h个像素的墨迹点阵，逐行连续排列，高位在前，与dr_tft_font.c一致"""
+    x0, y0, w, h = ink_bbox(cell)
+    packer = BitPacker(bpp)
+    for row in cell[y0:y0 + h]:
+        for v in row[x0:x0 + w]:
+            packer.put(v)
+    packer.flush()
+    return bytes([x0, y0, w, h]) + bytes(packer.out)
+
+def comment_text(chars):
+    """用于C注释的字符，反斜杠位于行末时会把下一行接进注释，替换为全角字符"""
+    return ''.join('＼' if ch == '\\' else ch for ch in chars)
+
+def write_c_array(f, ctype, name, values, per_line, fmt):
+    f.write(f"const {ctype} {name}[{len(values)}] = {{\n")
+    for i in range(0, len(values), per_line):
+        f.write("    " + ", ".join(fmt.format(v) for v in values[i:i + per_line]))
+        f.write(",\n" if i + per_line < len(values) else "\n")
+    f.write("};\n\n")
+
+def save_font_header(glyphs, width, height, output_path, name, source, bbox=False, bpp=1, labels=None):
+    """glyphs为按码位升序排列的(字符, 点阵字节)列表，bbox为True时点阵为包围盒格式
+    labels不为None时第i个字形的码位即i，不生成码位表，labels为各字形的说明"""
+    codes = [ord(ch) for ch, _ in glyphs]
+    bitmap = b''.join(data for _, data in glyphs)
+    offsets, pos = [], 0
+    for _, data in glyphs:
+        offsets.append(pos)
+        pos += len(data)
+    if bbox and pos > 0xFFFF:
+        raise ValueError("包围盒格式的点阵超过64KB，16位偏移无法表示")
+    guard = f"{name.upper()}_H"
+    with open(output_path, 'w', encoding='utf-8') as f:
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        f.write('#include "dr_tft_font.h"\n\n')
+        f.write("/*\n")
+        f.write(f" * 由gen_font.py从{os.path.basename(source)}生成，请勿手工修改\n")
+        f.write(f" * 字形尺寸: {width} x {height}，每像素{bpp}位，共{len(glyphs)}个字形，{len(bitmap)}字节")
+        if bbox:
+            full = len(glyphs) * ((width * bpp + 7) // 8) * height
+            f.write(f"(包围盒格式，另有偏移表{len(glyphs) * 2}字节；整格格式为{full}字节)")
+        f.write("\n")
+        if labels is None:
+            f.write(f" * 字符: {comment_text(ch for ch, _ in glyphs)}\n")
+        else:
+            f.write(" * 字形序号即码位，没有码位表\n")
+        f.write(" */\n\n")
+        if labels is None:
+            write_c_array(f, "uint16_t", f"{name}_codes", codes, 8, "0x{:04X}")
+        f.write(f"const uint8_t {name}_bitmap[{len(bitmap)}] = {{\n")
+        for i, (ch, data) in enumerate(glyphs):
+            f.write("    " + ", ".join(f"0x{b:02X}" for b in data))
+            f.write("," if i + 1 < len(glyphs) else " ")
+            if labels is None:
+                f.write(f" // U+{ord(ch):04X} {comment_text(ch)}\n")
+            else:
+                f.write(f" // {i} {comment_text(labels[i])}".rstrip() + "\n")
+        f.write("};\n\n")
+        codes_name = f"{name}_codes" if labels is None else "0"
+        offsets_name = f"{name}_offsets" if bbox else "0"
+        if bbox:
+            write_c_array(f, "uint16_t", f"{name}_offsets", offsets, 8, "0x{:04X}")
+        f.write(f"const TftFont {name} = {{ {len(glyphs)}, {width}, {height}, {codes_name}, {name}_bitmap, {offsets_name}, {bpp} }};\n\n")
+        f.write(f"#endif // {guard}\n")
+    total = len(bitmap) + (len(glyphs) * 2 if bbox else 0)
+    print(f"✅ {len(glyphs)}个字形 (平均{total / len(glyphs):.1f}字节/字形) 已保存到: {output_path}")
+
+def preview(cell, bpp):
+    shades = '.#' if bpp == 1 else '.:+#'
+    for row in cell:
+        print(''.join(shades[v] for v in row))
+
+def main():
+    parser = argparse.ArgumentParser(description='从BDF/TTF字体提取字符串用到的字形，导出etft_DisplayUTF8使用的C头文件')
+    parser.add_argument('font', help='BDF或TTF/OTF字体文件，加--cells时为整格字模的C数组文件')
+    parser.add_argument('sources', nargs='*', help='扫描其中字符串字面量的源文件，如../Lab-7-TFTLCD/main.c')
+    parser.add_argument('-o', '--output', default='dr_tft_font16.h', help='输出的C头文件 (默认: dr_tft_font16.h)')
+    parser.add_argument('--name', help='字库变量名 (默认: 由输出文件名生成)')
+    parser.add_argument('--text', help='额外需要的字符')
+    parser.add_argument('--ascii', action='store_true', help='同时提取可打印ASCII字符，否则ASCII使用tft_ascii')
+    parser.add_argument('--width', type=int, default=16, help='字形宽度 (默认: 16)')
+    parser.add_argument('--height', type=int, default=16, help='字形高度 (默认: 16)')
+    parser.add_argument('--size', type=int, help='TTF渲染的像素大小 (默认: 与高度相同)')
+    parser.add_argument('--bpp', type=int, choices=[1, 2], default=1,
+                        help='每像素位数，2为4级灰度抗锯齿，需使用TTF字体 (默认: 1)')
+    parser.add_argument('--threshold', type=int, default=128, help='TTF渲染后二值化的灰度阈值 (默认: 128)')
+    parser.add_argument('--bbox', action='store_true', help='按墨迹包围盒压缩存储，空白边距不占空间')
+    parser.add_argument('--cells', action='store_true',
+                        help='把整格字模C数组(如dr_tft_ascii.h，--width 8)按--width/--height切分后转换，字形序号即码位')
+    parser.add_argument('--preview', action='store_true', help='在终端打印每个字形')
+    args = parser.parse_args()
+    name = args.name or os.path.splitext(os.path.basename(args.output))[0].replace('-', '_')
+
+    if args.cells:
+        cells = CellArray(args.font, args.width, args.height)
+        glyphs = []
+        for i, cell in enumerate(cells.cells):
+            if args.preview:
+                print(f"{i} {cells.labels[i]}")
+                preview(cell, 1)
+            glyphs.append((chr(i), pack_glyph_bbox(cell) if args.bbox else pack_glyph(cell, args.width)))
+        save_font_header(glyphs, args.width, args.height, args.output, name, args.font, args.bbox, 1, cells.labels)
+        return 0
+
+    chars = collect_chars(args.sources, args.text, args.ascii)
+    if not chars:
+        print("❌ 没有需要提取的字符")
+        return 1
+    font = open_font(args.font, args.size or args.height)
+
+    glyphs, missing = [], []
+    for ch in chars:
+        cell = font.render(ch, args.width, args.height, args.threshold, args.bpp)
+        if cell is None:
+            missing.append(ch)
+            continue
+        if args.preview:
+            print(f"U+{ord(ch):04X} {ch}")
+            preview(cell, args.bpp)
+        glyphs.append((ch, pack_glyph_bbox(cell, args.bpp) if args.bbox else pack_glyph(cell, args.width, args.bpp)))
+    if missing:
+        print(f"⚠️ 字体中缺少{len(missing)}个字符，将显示为空心方框: {''.join(missing)}")
+    if not glyphs:
+        print("❌ 没有提取到任何字形")
+        return 1
+    save_font_header(glyphs, args.width, args.height, args.output, name, args.font, args.bbox, args.bpp)
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,304 @@
+# 资源打包工具：按清单把图像与字库转换为设备格式，去重后合并为一个数据块，生成.c数据文件与索引头文件
+# 默认放在.tftassets段，由lnk_msp430f6638.cmd放入0x10000起的FLASH2(224KB)，指向它的指针超过16位，
+# Lab-7工程已使用大数据模型(--data_model=large，RTS库为libc.a，由链接器按数据模型自动选择)，
+# 生成的文件在小数据模型下会以#error停止编译
+# 加--near(或清单中"near": true)时放在.tftassets_near段，位于0x8000起的FLASH，与代码、.const、中断向量共用，
+# 须用--map给出上次链接生成的.map文件，按其中FLASH已用的空间检查是否放得下
+#
+# 清单为JSON，路径相对于清单所在目录，例如:
+# {
+#   "output": "../Lab-7-TFTLCD/tft_assets",
+#   "assets": [
+#     { "name": "bear", "type": "c565", "file": "bear.png" },
+#     { "name": "logo", "type": "rle", "file": "logo.png" },
+#     { "name": "photo", "type": "qoi", "file": "photo.png" },
+#     { "name": "ship", "type": "sprite", "file": "ship.png", "key": "FF00FF" },
+#     { "name": "icon", "type": "indexed", "file": "icon.png", "bpp": 1 },
+#     { "name": "ui", "type": "font", "file": "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+#       "sources": ["../Lab-7-TFTLCD/main.c"], "ascii": true, "bpp": 2, "size": 14, "bbox": true }
+#   ]
+# }
+# type取值: bgr(etft_DisplayImage)、c565、rle、qoi、sprite、indexed、font，图像选项与extract_bgr.py相同，
+# 字库选项与gen_font.py相同(sources、text、ascii、width、height、size、threshold、bpp、bbox)
+import argparse
+import hashlib
+import json
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+import extract_bgr
+import gen_font
+
+SECTION_FAR = ".tftassets"
+SECTION_NEAR = ".tftassets_near"
+FAR_FLASH_SIZE = 0x38000  # lnk_msp430f6638.cmd中FLASH2的长度，FLASH放不下的.text与.const也会放到这里
+
+class Blob:
+    """合并后的数据块，内容相同的片段只存一份"""
+
+    def __init__(self):
+        self.data = bytearray()
+        self.offsets = {}  # 片段内容的摘要 -> 偏移
+        self.requested = 0  # 去重前的总字节数
+        self.labels = []  # (偏移, 说明)
+
+    def add(self, data, label, align=2):
+        """加入一个片段，返回其偏移；uint16数组与DMA源数据按2字节对齐"""
+        data = bytes(data)
+        self.requested += len(data)
+        key = hashlib.sha1(data).digest()
+        if key in self.offsets:
+            return self.offsets[key]
+        while len(self.data) % align:
+            self.data.append(0)
+        offset = len(self.data)
+        self.data += data
+        self.offsets[key] = offset
+        self.labels.append((offset, label))
+        return offset
+
+def u16_le(values):
+    """uint16数组按MSP430的小端字节序存放"""
+    out = bytearray()
+    for v in values:
+        out += bytes([v & 0xFF, v >> 8])
+    return bytes(out)
+
+def load_image(path):
+    bgr_data, bgr_array, info = extract_bgr.extract_bgr_array(path)
+    if bgr_data is None:
+        raise ValueError(f"无法读取图像: {path}")
+    return bgr_data, bgr_array, info
+
+def pack_image(blob, asset, path):
+    """返回索引头文件中的条目说明"""
+    kind = asset['type']
+    bgr_data, bgr_array, info = load_image(path)
+    width, height = info['width'], info['height']
+    entry = {'name': asset['name'], 'type': kind, 'width': width, 'height': height}
+
+    if kind == 'bgr':
+        data = bgr_data.tobytes()
+    elif kind == 'indexed':
+        bpp = asset.get('bpp', 4)
+        indices, palette = extract_bgr.quantize_indexed(bgr_array, bpp, asset.get('dither', False))
+        data = extract_bgr.pack_indices(indices, bpp)
+        entry['palette'] = blob.add(u16_le(palette), f"{asset['name']} palette")
+        entry['bpp'] = bpp
+        entry['palette_size'] = len(palette) * 2
+    else:
+        raw = extract_bgr.bgr_to_rgb565(bgr_array)
+        if kind == 'c565':
+            data = raw
+        elif kind == 'rle':
+            data = extract_bgr.encode_rle565(raw)
+        elif kind == 'qoi':
+            data = extract_bgr.encode_qoi565(raw)
+        elif kind == 'sprite':
+            key = extract_bgr.parse_key_color(asset['key']) if 'key' in asset else (raw[0] << 8) | raw[1]
+            data, _ = extract_bgr.encode_sprite565(raw, width, height, key)
+        else:
+            raise ValueError(f"{asset['name']}: 未知的类型 {kind}")
+    entry['offset'] = blob.add(data, asset['name'])
+    entry['size'] = len(data)
+    return entry
+
+def pack_font(blob, asset, path, base):
+    width, height = asset.get('width', 16), asset.get('height', 16)
+    bpp, bbox = asset.get('bpp', 1), asset.get('bbox', False)
+    sources = [os.path.join(base, p) for p in asset.get('sources', [])]
+    chars = gen_font.collect_chars(sources, asset.get('text'), asset.get('ascii', False))
+    font = gen_font.open_font(path, asset.get('size', height))
+
+    glyphs, missing = [], []
+    for ch in chars:
+        cell = font.render(ch, width, height, asset.get('threshold', 128), bpp)
+        if cell is None:
+            missing.append(ch)
+            continue
+        glyphs.append((ch, gen_font.pack_glyph_bbox(cell, bpp) if bbox else gen_font.pack_glyph(cell, width, bpp)))
+    if missing:
+        print(f"⚠️ {asset['name']}: 字体中缺少{len(missing)}个字符，将显示为空心方框: {''.join(missing)}")
+    if not glyphs:
+        raise ValueError(f"{asset['name']}: 没有提取到任何字形")
+
+    bitmap = b''.join(data for _, data in glyphs)
+    entry = {'name': asset['name'], 'type': 'font', 'width': width, 'height': height, 'bpp': bpp,
+             'count': len(glyphs), 'chars': ''.join(ch for ch, _ in glyphs)}
+    entry['codes'] = blob.add(u16_le([ord(ch) for ch, _ in glyphs]), f"{asset['name']} codes")
+    entry['offset'] = blob.add(bitmap, f"{asset['name']} bitmap")
+    entry['size'] = len(bitmap)
+    entry['offsets'] = None
+    if bbox:
+        offsets, pos = [], 0
+        for _, data in glyphs:
+            offsets.append(pos)
+            pos += len(data)
+        if pos > 0xFFFF:
+            raise ValueError(f"{asset['name']}: 包围盒格式的点阵超过64KB，16位偏移无法表示")
+        entry['offsets'] = blob.add(u16_le(offsets), f"{asset['name']} offsets")
+    return entry
+
+def c_name(name):
+    name = name.replace('-', '_').replace(' ', '_')
+    if not name.isidentifier():
+        raise ValueError(f"资源名不是合法的C标识符: {name}")
+    return name
+
+def near_flash_free(map_path):
+    """
+    从TI链接器的.map文件中取0x8000起的FLASH的剩余字节数
+    上次链接若已放入近端资源，其所占空间不算已用，重新打包时会替换它
+    """
+    free, previous = None, 0
+    with open(map_path, encoding='utf-8', errors='replace') as f:
+        for line in f:
+            fields = line.split()
+            # MEMORY CONFIGURATION: 名称 起点 长度 已用 未用 属性
+            if len(fields) >= 5 and fields[0] == 'FLASH':
+                free = int(fields[4], 16)
+            # SECTION ALLOCATION MAP: 段名 页 起点 长度
+            elif len(fields) >= 4 and fields[0] == SECTION_NEAR:
+                previous = int(fields[3], 16)
+    if free is None:
+        raise ValueError(f"{map_path}中没有找到FLASH的用量")
+    return free + previous
+
+def write_model_check(f):
+    f.write("#ifndef __LARGE_DATA_MODEL__\n")
+    f.write('#error "资源数据块位于FLASH2(0x10000以上)，须使用--data_model=large编译"\n')
+    f.write("#endif\n\n")
+
+def write_header(path, entries, blob, manifest_name, far):
+    base = os.path.splitext(os.path.basename(path))[0]
+    guard = f"{base.upper()}_H"
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        f.write('#include "dr_tft.h"\n')
+        if any(e['type'] == 'font' for e in entries):
+            f.write('#include "dr_tft_font.h"\n')
+        f.write("\n/*\n")
+        f.write(f" * 由pack_assets.py根据{manifest_name}生成，请勿手工修改\n")
+        f.write(f" * 共{len(entries)}项资源，数据块{len(blob.data)}字节")
+        if far:
+            f.write(f"(去重前{blob.requested}字节)，位于{SECTION_FAR}段(FLASH2)，须使用大数据模型\n")
+        else:
+            f.write(f"(去重前{blob.requested}字节)，位于{SECTION_NEAR}段(FLASH)\n")
+        f.write(" */\n\n")
+        if far:
+            write_model_check(f)
+        f.write(f"extern const uint8_t {base}[{len(blob.data)}];\n\n")
+        for e in entries:
+            name = c_name(e['name'])
+            upper = name.upper()
+            if e['type'] == 'font':
+                f.write(f"//{e['width']}x{e['height']}，每像素{e['bpp']}位，{e['count']}个字形\n")
+                f.write(f"extern const TftFont {name};\n\n")
+                continue
+            if e['type'] == 'indexed':
+                f.write(f"//{e['width']}x{e['height']}，{e['bpp']}位调色板索引\n")
+                f.write(f"extern const TftIndexedImage {name};\n\n")
+                continue
+            f.write(f"//{e['width']}x{e['height']}，{e['type']}格式\n")
+            f.write(f"#define ASSET_{upper} ({base} + 0x{e['offset']:05X})\n")
+            f.write(f"#define ASSET_{upper}_WIDTH  {e['width']}\n")
+            f.write(f"#define ASSET_{upper}_HEIGHT {e['height']}\n")
+            f.write(f"#define ASSET_{upper}_SIZE   {e['size']}\n\n")
+        f.write(f"#endif // {guard}\n")
+
+def write_source(path, header, entries, blob, far):
+    base = os.path.splitext(os.path.basename(path))[0]
+    labels = dict(blob.labels)
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(f'#include "{os.path.basename(header)}"\n\n')  # 远端放置时头文件中已检查数据模型
+        f.write(f'#pragma DATA_SECTION({base}, "{SECTION_FAR if far else SECTION_NEAR}")\n')
+        f.write(f"const uint8_t {base}[{len(blob.data)}] = {{\n")
+        data = blob.data
+        for i in range(0, len(data), 16):
+            f.write("    " + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]))
+            f.write("," if i + 16 < len(data) else " ")
+            marks = [f"0x{o:05X} {labels[o]}" for o in range(i, i + 16) if o in labels]
+            if marks:
+                f.write(f" // {', '.join(marks)}")
+            f.write("\n")
+        f.write("};\n")
+        for e in entries:
+            name = c_name(e['name'])
+            if e['type'] == 'indexed':
+                f.write(f"\nconst TftIndexedImage {name} = {{\n")
+                f.write(f"    {e['width']}, {e['height']}, {e['bpp']}, {base} + 0x{e['offset']:05X}, "
+                        f"(const uint16_t*)({base} + 0x{e['palette']:05X})\n")
+                f.write("};\n")
+            elif e['type'] == 'font':
+                offsets = f"(const uint16_t*)({base} + 0x{e['offsets']:05X})" if e['offsets'] is not None else "0"
+                f.write(f"\nconst TftFont {name} = {{\n")
+                f.write(f"    {e['count']}, {e['width']}, {e['height']}, (const uint16_t*)({base} + 0x{e['codes']:05X}),\n")
+                f.write(f"    {base} + 0x{e['offset']:05X}, {offsets}, {e['bpp']}\n")
+                f.write("};\n")
+
+def main():
+    parser = argparse.ArgumentParser(description='按清单打包图像与字库，生成放在FLASH2中的资源数据块与索引头文件')
+    parser.add_argument('manifest', help='JSON格式的资源清单')
+    parser.add_argument('-o', '--output', help='输出文件名(不含扩展名)，覆盖清单中的output (默认: tft_assets)')
+    parser.add_argument('--near', action='store_true', help='放在0x8000起的FLASH，须同时给出--map')
+    parser.add_argument('--map', help='上次链接生成的.map文件，用于计算FLASH的剩余空间')
+    args = parser.parse_args()
+
+    with open(args.manifest, encoding='utf-8') as f:
+        manifest = json.load(f)
+    base = os.path.dirname(os.path.abspath(args.manifest))
+    output = args.output or os.path.join(base, manifest.get('output', 'tft_assets'))
+    if not os.path.splitext(os.path.basename(output))[0].isidentifier():
+        print(f"❌ 输出文件名须为合法的C标识符: {output}")
+        return 1
+
+    far = not (args.near or manifest.get('near', False))
+    if not far and not args.map:
+        print("❌ --near须用--map给出上次链接生成的.map文件，FLASH中已有代码与.const，不能只按其总长度检查")
+        return 1
+    blob, entries = Blob(), []
+    names = set()
+    for asset in manifest['assets']:
+        name = c_name(asset['name'])
+        if name in names:
+            print(f"❌ 资源名重复: {name}")
+            return 1
+        names.add(name)
+        path = os.path.join(base, asset['file'])
+        if not os.path.exists(path):
+            print(f"❌ 文件不存在: {path}")
+            return 1
+        if asset['type'] == 'font':
+            entries.append(pack_font(blob, asset, path, base))
+        else:
+            entries.append(pack_image(blob, asset, path))
+        print(f"🔄 {name}: {asset['type']} {os.path.basename(path)}")
+
+    if far and len(blob.data) > FAR_FLASH_SIZE:
+        print(f"❌ 数据块{len(blob.data)}字节，超过0x10000起的FLASH2({FAR_FLASH_SIZE}字节)，请减少资源")
+        return 1
+    if not far:
+        free = near_flash_free(args.map)
+        if len(blob.data) > free:
+            print(f"❌ 数据块{len(blob.data)}字节，超过0x8000起的FLASH的剩余空间({free}字节，按{args.map})，"
+                  "请减少资源或去掉--near放在FLASH2")
+            return 1
+
+    header, source = output + '.h', output + '.c'
+    write_header(header, entries, blob, os.path.basename(args.manifest), far)
+    write_source(source, header, entries, blob, far)
+    print(f"✅ {len(entries)}项资源，数据块{len(blob.data)}字节 (去重前{blob.requested}字节)")
+    print(f"   {source}")
+    print(f"   {header}")
+    if far:
+        print(f"⚠️ 数据块位于{SECTION_FAR}段(FLASH2，0x10000以上)，16位指针无法访问，"
+              "工程须使用大数据模型(--data_model=large)及对应的RTS库，否则编译时报错")
+    else:
+        print(f"⚠️ 数据块位于{SECTION_NEAR}段(0x8000起的FLASH)，剩余空间按{args.map}计算，"
+              "代码或.const增加后须重新检查，链接时空间不足请去掉--near")
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -25,6 +25,33 @@
     tft_SendCmd(x, y); \
     __delay_cycles(MCLK_FREQ / 1000 * z);
 
+#if TFT_USE_TIMING
+//像素流统计：本次像素数与开始时刻(TB0计数值)
+static uint32_t pixel_count = 0;
+static uint16_t pixel_start_tick = 0;
+static uint32_t last_pixel_count = 0;
+static uint16_t last_pixel_ticks = 0;
+#define TFT_COUNT_PIXELS(n) (pixel_count += (n))
+#else
+#define TFT_COUNT_PIXELS(n)
+#endif
+
+#if TFT_USE_DMA
+    #define TFT_DMA_TRIGGER DMA0TSEL_23 //UCB1TXIFG
+    #define TFT_DMA_MAX_CHUNK 0xFFFE //DMA0SZ为16位，按偶数字节分段
+
+static volatile uint8_t dma_busy = 0;
+static const uint8_t* dma_src; //下一段的源地址
+static uint32_t dma_remain; //剩余字节数
+static uint16_t dma_ctl; //每段使用的DMA0CTL
+static uint16_t dma_chunk_limit; //每段最大字节数
+static uint8_t dma_advance; //每段结束后源地址是否后移
+static tft_DmaCallback dma_callback;
+static uint8_t dma_pattern[TFT_DMA_FILL_PIXELS * 2]; //大端RGB565颜色图样
+static uint16_t dma_pattern_color; //图样中当前的颜色
+static uint8_t dma_pattern_valid = 0;
+#endif
+
 //初始化TFT
 void initTFT() {
     //初始化RS、CS端口
@@ -54,6 +81,17 @@ void initTFT() {
     P8DIR |= BIT4 + BIT5;
     UCB1CTL1 &= ~UCSWRST;
 
+#if TFT_USE_TIMING
+    //TB0以ACLK连续计数，用于统计像素流速度
+    TB0CTL = TBSSEL__ACLK + MC__CONTINUOUS + TBCLR;
+#endif
+
+#if TFT_USE_DMA
+    //DMA通道0由UCB1TXIFG触发
+    DMACTL0 = (DMACTL0 & ~0x001F) | TFT_DMA_TRIGGER;
+    DMACTL4 = DMARMWDIS; //CPU读改写指令执行期间不插入DMA传输
+#endif
+
     //写入初始化TFTLCD的指令
     tft_send_and_wait(TFTREG_SOFT_RESET, 0x0001); //软件复位
     tft_send_and_wait(0x100, 0x0000); /*power supply setup*/
@@ -161,3 +199,212 @@ int tft_SendCmd(uint16_t reg, uint16_t data) {
     tft_SendData(data);
     return 1;
 }
+
+//设置显示窗口并发出RAM写入地址
+void tft_SetWindow(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY) {
+    tft_SendCmd(TFTREG_WIN_MINX, startX);
+    tft_SendCmd(TFTREG_WIN_MINY, startY);
+    tft_SendCmd(TFTREG_WIN_MAXX, endX);
+    tft_SendCmd(TFTREG_WIN_MAXY, endY);
+    tft_SendCmd(TFTREG_RAM_XADDR, startX);
+    tft_SendCmd(TFTREG_RAM_YADDR, startY);
+    tft_SendIndex(TFTREG_RAM_ACCESS);
+}
+
+#if TFT_USE_TIMING
+//TB0与MCLK异步，连续读到两次相同的值才可信
+static uint16_t tft_ReadTick() {
+    uint16_t t;
+    do {
+        t = TB0R;
+    } while (t != TB0R);
+    return t;
+}
+#endif
+
+//开始一次像素流写入
+void tft_BeginPixels() {
+    LCD_CS_CLR;
+    LCD_RS_SET; //整个像素流期间RS保持为高
+#if TFT_USE_TIMING
+    pixel_count = 0;
+    pixel_start_tick = tft_ReadTick();
+#endif
+}
+
+//向像素流写入一个像素，不等待移位寄存器排空
+void tft_PushPixel(uint16_t color) {
+    while (!(UCB1IFG & UCTXIFG))
+        ; //等待发送缓冲区空
+    UCB1TXBUF = color >> 8; //发送高位
+    while (!(UCB1IFG & UCTXIFG))
+        ; //等待发送缓冲区空
+    UCB1TXBUF = color & 0xFF; //发送低位
+    TFT_COUNT_PIXELS(1);
+}
+
+//向像素流依次写入count个像素
+void tft_PushPixels(const uint16_t* colors, uint16_t count) {
+    uint16_t i;
+    for (i = 0; i < count; i++) {
+        uint16_t color = colors[i];
+        while (!(UCB1IFG & UCTXIFG))
+            ;
+        UCB1TXBUF = color >> 8;
+        while (!(UCB1IFG & UCTXIFG))
+            ;
+        UCB1TXBUF = color & 0xFF;
+    }
+    TFT_COUNT_PIXELS(count);
+}
+
+//向像素流写入count个相同颜色的像素
+void tft_PushPixelRepeat(uint16_t color, uint32_t count) {
+    uint8_t high = color >> 8;
+    uint8_t low = color & 0xFF;
+    uint32_t i;
+    for (i = 0; i < count; i++) {
+        while (!(UCB1IFG & UCTXIFG))
+            ;
+        UCB1TXBUF = high;
+        while (!(UCB1IFG & UCTXIFG))
+            ;
+        UCB1TXBUF = low;
+    }
+    TFT_COUNT_PIXELS(count);
+}
+
+//结束像素流写入
+void tft_EndPixels() {
+    while (UCB1STAT & UCBUSY)
+        ; //等待最后一位实际送出
+    LCD_CS_SET;
+#if TFT_USE_TIMING
+    last_pixel_ticks = tft_ReadTick() - pixel_start_tick;
+    last_pixel_count = pixel_count;
+#endif
+}
+
+#if TFT_USE_TIMING
+
+//返回最近一次像素流的实测写入速度(像素/秒)，单次计时超过2s(ACLK下TB0的周期)时结果无效
+uint32_t tft_PixelsPerSecond() {
+    if (last_pixel_ticks == 0)
+        return 0;
+    return (uint32_t)((uint64_t)last_pixel_count * ACLK_FREQ / last_pixel_ticks);
+}
+#endif
+
+#if TFT_USE_DMA
+//启动下一段DMA传输，全部完成时返回1
+static int tft_DmaNext() {
+    uint16_t size;
+    if (dma_remain == 0) {
+        dma_busy = 0;
+        if (dma_callback)
+            dma_callback();
+        return 1;
+    }
+
+    size = dma_remain > dma_chunk_limit ? dma_chunk_limit : dma_remain;
+    dma_remain -= size;
+
+    DMA0CTL = 0;
+    __data16_write_addr((unsigned short)&DMA0SA, (unsigned long)dma_src);
+    __data16_write_addr((unsigned short)&DMA0DA, (unsigned long)&UCB1TXBUF);
+    DMA0SZ = size;
+    if (dma_advance)
+        dma_src += size; //下一段紧接本段
+    DMA0CTL = dma_ctl;
+
+    //DMA由UCTXIFG的上升沿触发，等发送缓冲区空后人为制造一次上升沿
+    while (!(UCB1IFG & UCTXIFG))
+        ;
+    UCB1IFG &= ~UCTXIFG;
+    UCB1IFG |= UCTXIFG;
+    return 0;
+}
+
+//src_incr为源地址的递增方式，advance为0时每段都从src重新开始发送
+static void tft_DmaStart(const uint8_t* src,
+                         uint32_t bytes,
+                         uint16_t src_incr,
+                         uint16_t limit,
+                         uint8_t advance,
+                         tft_DmaCallback callback) {
+    dma_src = src;
+    dma_remain = bytes;
+    dma_ctl = DMADT_0 + src_incr + DMADSTINCR_0 + DMASRCBYTE + DMADSTBYTE + DMAIE + DMAEN;
+    dma_chunk_limit = limit;
+    dma_advance = advance;
+    dma_callback = callback;
+    dma_busy = 1;
+    TFT_COUNT_PIXELS(bytes / 2);
+    tft_DmaNext();
+}
+
+//以DMA写入count个相同颜色的像素
+void tft_DmaFill(uint16_t color, uint32_t count, tft_DmaCallback callback) {
+    uint8_t high = color >> 8;
+    uint8_t low = color & 0xFF;
+    uint16_t i;
+
+    if (high == low) { //高低字节相同，固定源地址，每段可发送约32k像素
+        dma_pattern[0] = high;
+        dma_pattern_valid = 0;
+        tft_DmaStart(dma_pattern, count * 2, DMASRCINCR_0, TFT_DMA_MAX_CHUNK, 0, callback);
+        return;
+    }
+
+    if (!dma_pattern_valid || dma_pattern_color != color) { //颜色未变时沿用上次的图样
+        for (i = 0; i < sizeof(dma_pattern); i += 2) {
+            dma_pattern[i] = high;
+            dma_pattern[i + 1] = low;
+        }
+        dma_pattern_color = color;
+        dma_pattern_valid = 1;
+    }
+    tft_DmaStart(dma_pattern, count * 2, DMASRCINCR_3, sizeof(dma_pattern), 0, callback);
+}
+
+//以DMA写入count个预先转换好的像素
+void tft_DmaWrite(const uint8_t* data, uint32_t count, tft_DmaCallback callback) {
+    tft_DmaStart(data, count * 2, DMASRCINCR_3, TFT_DMA_MAX_CHUNK, 1, callback);
+}
+
+int tft_DmaBusy() {
+    return dma_busy;
+}
+
+//等待DMA传输完成
+void tft_DmaWait() {
+    if (__get_SR_register() & GIE) {
+        __disable_interrupt(); //检查标志与进入低功耗之间不能被DMA中断插入
+        while (dma_busy) {
+            __bis_SR_register(LPM0_bits + GIE); //由DMA完成中断唤醒
+            __disable_interrupt();
+        }
+        __enable_interrupt();
+    } else {
+        //总中断关闭时查询DMA标志，由CPU启动后续各段
+        while (dma_busy) {
+            if (DMA0CTL & DMAIFG) {
+                DMA0CTL &= ~DMAIFG;
+                tft_DmaNext();
+            }
+        }
+    }
+}
+
+    #pragma vector = DMA_VECTOR
+__interrupt void tft_DmaIsr(void) {
+    switch (__even_in_range(DMAIV, 16)) {
+        case 2: //DMA0IFG
+            if (tft_DmaNext())
+                __bic_SR_register_on_exit(LPM0_bits); //传输完成，唤醒tft_DmaWait
+            break;
+        default:
+            break;
+    }
+}
+#endif
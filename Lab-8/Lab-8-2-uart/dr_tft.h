@@ -11,8 +11,33 @@
     #define SMCLK_FREQ 20000000
 #endif
 
+#ifndef ACLK_FREQ
+    #define ACLK_FREQ 32768
+#endif
+
 #define SPI_FREQ 2000000
 
+//是否使用DMA通道0(由UCB1TXIFG触发)发送大块像素数据，DMA中断由驱动占用
+#ifndef TFT_USE_DMA
+    #define TFT_USE_DMA 1
+#endif
+
+//是否占用定时器TB0(ACLK连续计数)统计像素流速度，initTFT会清零并重新配置TB0
+//本工程不使用该统计，默认关闭，此时不提供tft_PixelsPerSecond
+#ifndef TFT_USE_TIMING
+    #define TFT_USE_TIMING 0
+#endif
+
+//像素数少于此值时直接由CPU发送，DMA的启动开销不划算
+#define TFT_DMA_MIN_PIXELS 32
+
+//tft_DmaFill在颜色高低字节不同时循环发送的颜色图样长度(像素)，占用2倍字节的RAM
+//每发送完一遍图样进一次DMA中断重新启动，整屏填充约需76800 / TFT_DMA_FILL_PIXELS次中断
+//不用重复块传输模式：最后一块结束后下一次触发在一个SPI字节时间内到来，短于中断响应时间，无法及时停止
+#ifndef TFT_DMA_FILL_PIXELS
+    #define TFT_DMA_FILL_PIXELS 512
+#endif
+
 #define TFT_XSIZE 240
 #define TFT_YSIZE 320
 
@@ -41,6 +66,51 @@ int tft_SendData(uint16_t val);
 //向TFT屏的寄存器reg发送数据data，返回是否发送成功
 int tft_SendCmd(uint16_t reg, uint16_t data);
 
+//设置显示窗口并发出RAM写入地址，之后即可用像素流接口填充窗口
+void tft_SetWindow(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY);
+
+/* 像素流接口 */
+/* 片选只在开始时拉低一次，RS保持为高，只在结束时等待移位寄存器排空 */
+
+//开始一次像素流写入，须在tft_SetWindow之后调用
+void tft_BeginPixels();
+
+//向像素流写入一个像素
+void tft_PushPixel(uint16_t color);
+
+//向像素流依次写入count个像素
+void tft_PushPixels(const uint16_t* colors, uint16_t count);
+
+//向像素流写入count个相同颜色的像素
+void tft_PushPixelRepeat(uint16_t color, uint32_t count);
+
+//结束像素流写入，等待最后一位送出后释放片选
+void tft_EndPixels();
+
+#if TFT_USE_TIMING
+//返回最近一次像素流的实测写入速度，单位为像素/秒，计时基于TB0(ACLK)
+uint32_t tft_PixelsPerSecond();
+#endif
+
+#if TFT_USE_DMA
+/* DMA像素流接口，须在tft_BeginPixels与tft_EndPixels之间使用 */
+/* 传输期间CPU可进入LPM0，传输完成后在DMA中断中调用callback(可为0) */
+
+typedef void (*tft_DmaCallback)();
+
+//以DMA写入count个相同颜色的像素，高低字节相同时使用固定源地址，否则循环发送一段颜色图样
+void tft_DmaFill(uint16_t color, uint32_t count, tft_DmaCallback callback);
+
+//以DMA写入count个预先转换好的像素，data为大端RGB565字节流(即SPI发送顺序：高字节在前)
+void tft_DmaWrite(const uint8_t* data, uint32_t count, tft_DmaCallback callback);
+
+//返回DMA传输是否仍在进行
+int tft_DmaBusy();
+
+//等待DMA传输完成，总中断打开时在LPM0中等待
+void tft_DmaWait();
+#endif
+
 /* TFT屏高层接口 */
 /* 所有高层接口内置X、Y对调，即接口处X为横Y为纵 */
 
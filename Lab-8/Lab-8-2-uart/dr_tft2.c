@@ -3,21 +3,17 @@
 #include <msp430.h>
 
 void etft_AreaSet(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY, uint16_t color) {
-    uint16_t i, j;
-    tft_SendCmd(TFTREG_WIN_MINX, startX);
-    tft_SendCmd(TFTREG_WIN_MINY, startY);
-    tft_SendCmd(TFTREG_WIN_MAXX, endX);
-    tft_SendCmd(TFTREG_WIN_MAXY, endY);
-
-    tft_SendCmd(TFTREG_RAM_XADDR, startX);
-    tft_SendCmd(TFTREG_RAM_YADDR, startY);
-
-    tft_SendIndex(TFTREG_RAM_ACCESS);
-    for (i = 0; i < endY - startY + 1; i++) {
-        for (j = 0; j < endX - startX + 1; j++) {
-            tft_SendData(color);
-        }
-    }
+    uint32_t count = (uint32_t)(endX - startX + 1) * (endY - startY + 1);
+    tft_SetWindow(startX, startY, endX, endY);
+    tft_BeginPixels();
+#if TFT_USE_DMA
+    if (count >= TFT_DMA_MIN_PIXELS) {
+        tft_DmaFill(color, count, 0);
+        tft_DmaWait(); //传输期间CPU处于LPM0
+    } else
+#endif
+        tft_PushPixelRepeat(color, count);
+    tft_EndPixels();
 }
 
 void etft_DisplayString(const char* str, uint16_t sx, uint16_t sy, uint16_t fRGB, uint16_t bRGB) {
@@ -32,13 +28,8 @@ void etft_DisplayString(const char* str, uint16_t sx, uint16_t sy, uint16_t fRGB
         cx = 0;
         cy = 0;
         //屏幕是横的，XY要对调
-        tft_SendCmd(TFTREG_WIN_MINX, sx); //x start point
-        tft_SendCmd(TFTREG_WIN_MINY, sy); //y start point
-        tft_SendCmd(TFTREG_WIN_MAXX, sx + 7); //x end point
-        tft_SendCmd(TFTREG_WIN_MAXY, sy + 15); //y end point
-        tft_SendCmd(TFTREG_RAM_XADDR, sx); //x start point
-        tft_SendCmd(TFTREG_RAM_YADDR, sy); //y start point
-        tft_SendIndex(TFTREG_RAM_ACCESS);
+        tft_SetWindow(sx, sy, sx + 7, sy + 15);
+        tft_BeginPixels();
 
         uint16_t color;
         while (1) {
@@ -46,6 +37,7 @@ void etft_DisplayString(const char* str, uint16_t sx, uint16_t sy, uint16_t fRGB
                 cx = 0;
                 cy++;
                 if (cy >= 16) { //一个字符发送完毕
+                    tft_EndPixels();
                     cc++; //下一个字符
                     sx += 8;
                     if (sx >= TFT_YSIZE) //越过行末
@@ -62,7 +54,7 @@ void etft_DisplayString(const char* str, uint16_t sx, uint16_t sy, uint16_t fRGB
             else
                 color = bRGB;
 
-            tft_SendData(color);
+            tft_PushPixel(color);
             cx++; //X自增
         }
     }
@@ -81,20 +73,14 @@ void etft_DisplayImage(const uint8_t* image,
         row_length += 1;
     }
     const uint8_t* ptr = image + (height - 1) * row_length;
-    tft_SendCmd(TFTREG_WIN_MINX, sx);
-    tft_SendCmd(TFTREG_WIN_MINY, sy);
-    tft_SendCmd(TFTREG_WIN_MAXX, sx + width - 1);
-    tft_SendCmd(TFTREG_WIN_MAXY, sy + height - 1);
-
-    tft_SendCmd(TFTREG_RAM_XADDR, sx);
-    tft_SendCmd(TFTREG_RAM_YADDR, sy);
-
-    tft_SendIndex(TFTREG_RAM_ACCESS);
+    tft_SetWindow(sx, sy, sx + width - 1, sy + height - 1);
+    tft_BeginPixels();
     for (i = 0; i < height; i++) {
         for (j = 0; j < width; j++) {
-            tft_SendData(etft_Color(ptr[2], ptr[1], ptr[0]));
+            tft_PushPixel(etft_Color(ptr[2], ptr[1], ptr[0]));
             ptr += 3;
         }
         ptr -= width * 3 + row_length;
     }
+    tft_EndPixels();
 }
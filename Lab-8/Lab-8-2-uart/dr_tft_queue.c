@@ -0,0 +1,167 @@
+#include "dr_tft_queue.h"
+#include <msp430.h>
+
+#if !TFT_USE_DMA
+    #error dr_tft_queue requires TFT_USE_DMA
+#endif
+
+#if (TFT_QUEUE_DEPTH & (TFT_QUEUE_DEPTH - 1)) != 0
+    #error TFT_QUEUE_DEPTH must be a power of 2
+#endif
+
+extern unsigned char const tft_ascii[]; //定义于dr_tft_ascii.h
+
+enum { QCMD_FILL, QCMD_GLYPH, QCMD_IMAGE };
+
+//一条绘图命令
+typedef struct {
+    uint8_t type;
+    char ch; //QCMD_GLYPH的字符
+    uint16_t x0, y0, x1, y1; //窗口
+    uint16_t fg, bg; //QCMD_FILL只用fg
+    const uint8_t* data; //QCMD_IMAGE的像素数据
+} TftCommand;
+
+static TftCommand queue[TFT_QUEUE_DEPTH];
+static volatile uint16_t queue_head = 0; //下一个空位
+static volatile uint16_t queue_tail = 0; //正在执行或下一条待执行的命令
+static volatile uint8_t queue_running = 0; //queue_tail处的命令是否正在传输
+static uint8_t glyph_buf[8 * 16 * 2]; //展开后的字符像素，大端RGB565
+
+static void queue_Done();
+
+//执行queue_tail处的命令，只在主循环中调用，设置窗口与展开字模期间不关中断
+static void queue_Start() {
+    const TftCommand* cmd = &queue[queue_tail];
+    uint32_t count = (uint32_t)(cmd->x1 - cmd->x0 + 1) * (cmd->y1 - cmd->y0 + 1);
+
+    queue_running = 1;
+    tft_SetWindow(cmd->x0, cmd->y0, cmd->x1, cmd->y1);
+    tft_BeginPixels();
+    switch (cmd->type) {
+        case QCMD_FILL:
+            tft_DmaFill(cmd->fg, count, queue_Done);
+            break;
+        case QCMD_GLYPH: {
+            const unsigned char* bits = &tft_ascii[(uint8_t)cmd->ch * 16];
+            uint8_t* p = glyph_buf;
+            uint16_t cx, cy;
+            for (cy = 0; cy < 16; cy++) {
+                uint8_t row = bits[cy];
+                for (cx = 0; cx < 8; cx++) {
+                    uint16_t color = (row & 0x80) ? cmd->fg : cmd->bg;
+                    *p++ = color >> 8;
+                    *p++ = color & 0xFF;
+                    row <<= 1;
+                }
+            }
+            tft_DmaWrite(glyph_buf, 8 * 16, queue_Done);
+            break;
+        }
+        case QCMD_IMAGE:
+            tft_DmaWrite(cmd->data, count, queue_Done);
+            break;
+    }
+}
+
+//一条命令传输完毕，在DMA中断中被调用，只释放片选并让出位置，下一条由etft_QueuePoll启动
+//DMA中断返回时会唤醒LPM0中的主循环
+static void queue_Done() {
+    tft_EndPixels();
+    queue_tail = (queue_tail + 1) & (TFT_QUEUE_DEPTH - 1);
+    queue_running = 0;
+}
+
+//取得队首空位，队列已满时返回0
+static TftCommand* queue_Alloc() {
+    if (((queue_head + 1) & (TFT_QUEUE_DEPTH - 1)) == queue_tail)
+        return 0;
+    return &queue[queue_head];
+}
+
+//提交queue_Alloc取得的命令，队列空闲时立即开始执行
+static void queue_Commit() {
+    queue_head = (queue_head + 1) & (TFT_QUEUE_DEPTH - 1); //queue_head只在主循环中修改
+    etft_QueuePoll();
+}
+
+void etft_QueuePoll() {
+    if (!queue_running && queue_tail != queue_head)
+        queue_Start();
+}
+
+int etft_QueueAreaSet(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY, uint16_t color) {
+    TftCommand* cmd = queue_Alloc();
+    if (!cmd)
+        return 0;
+    cmd->type = QCMD_FILL;
+    cmd->x0 = startX;
+    cmd->y0 = startY;
+    cmd->x1 = endX;
+    cmd->y1 = endY;
+    cmd->fg = color;
+    queue_Commit();
+    return 1;
+}
+
+int etft_QueueChar(char ch, uint16_t sx, uint16_t sy, uint16_t fRGB, uint16_t bRGB) {
+    TftCommand* cmd = queue_Alloc();
+    if (!cmd)
+        return 0;
+    cmd->type = QCMD_GLYPH;
+    cmd->ch = ch;
+    cmd->x0 = sx;
+    cmd->y0 = sy;
+    cmd->x1 = sx + 7;
+    cmd->y1 = sy + 15;
+    cmd->fg = fRGB;
+    cmd->bg = bRGB;
+    queue_Commit();
+    return 1;
+}
+
+uint16_t etft_QueueString(const char* str, uint16_t sx, uint16_t sy, uint16_t fRGB, uint16_t bRGB) {
+    uint16_t cc = 0;
+    while (str[cc] != '\0') {
+        if (!etft_QueueChar(str[cc], sx, sy, fRGB, bRGB))
+            break;
+        cc++;
+        sx += 8;
+        if (sx >= TFT_YSIZE) //越过行末
+        {
+            sx = 0;
+            sy += 16;
+        }
+    }
+    return cc;
+}
+
+int etft_QueueImage(const uint8_t* data, uint16_t sx, uint16_t sy, uint16_t width, uint16_t height) {
+    TftCommand* cmd = queue_Alloc();
+    if (!cmd)
+        return 0;
+    cmd->type = QCMD_IMAGE;
+    cmd->data = data;
+    cmd->x0 = sx;
+    cmd->y0 = sy;
+    cmd->x1 = sx + width - 1;
+    cmd->y1 = sy + height - 1;
+    queue_Commit();
+    return 1;
+}
+
+uint16_t etft_QueueFree() {
+    return (queue_tail - queue_head - 1) & (TFT_QUEUE_DEPTH - 1);
+}
+
+void etft_QueueWait() {
+    //tft_DmaWait在总中断打开时于LPM0中等待，关闭时查询DMA标志，返回时总中断状态不变
+    if (queue_running)
+        tft_DmaWait();
+    etft_QueuePoll();
+}
+
+void etft_QueueFlush() {
+    while (queue_running || queue_tail != queue_head)
+        etft_QueueWait();
+}
@@ -0,0 +1,39 @@
+#ifndef __DR_TFT_QUEUE_H_
+#define __DR_TFT_QUEUE_H_
+
+#include "dr_tft.h"
+#include <stdint.h>
+
+/* TFT屏异步绘图队列 */
+/* 绘图调用只把命令放入队列后立即返回，像素数据由DMA发送 */
+/* DMA完成中断只结束当前命令，设置窗口、展开字模等耗时的工作在主循环的etft_QueuePoll中进行，不阻塞UART等其他中断 */
+/* 需要TFT_USE_DMA，队列接口只能在主循环中调用；队列工作期间不要再调用阻塞的etft_*接口，先用etft_QueueFlush等待队列清空 */
+
+//队列深度(条命令)，必须是2的整数次幂
+#define TFT_QUEUE_DEPTH 32
+
+//将一个区域置为某个颜色，队列已满时返回0
+int etft_QueueAreaSet(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY, uint16_t color);
+
+//在指定的位置显示一个8x16字符，队列已满时返回0
+int etft_QueueChar(char ch, uint16_t sx, uint16_t sy, uint16_t fRGB, uint16_t bRGB);
+
+//在指定的位置显示一个字符串，换行规则与etft_DisplayString相同，返回成功放入队列的字符数
+uint16_t etft_QueueString(const char* str, uint16_t sx, uint16_t sy, uint16_t fRGB, uint16_t bRGB);
+
+//显示一块图像，data为大端RGB565字节流，执行完之前data必须保持有效，队列已满时返回0
+int etft_QueueImage(const uint8_t* data, uint16_t sx, uint16_t sy, uint16_t width, uint16_t height);
+
+//返回队列剩余空间(条命令)
+uint16_t etft_QueueFree();
+
+//上一条命令已完成时启动下一条，主循环中须经常调用，否则队列在当前命令完成后停止
+void etft_QueuePoll();
+
+//等待正在执行的命令完成并启动下一条，返回时队列至少有一个空位；总中断状态不变
+void etft_QueueWait();
+
+//等待队列中的命令全部执行完，总中断状态不变
+void etft_QueueFlush();
+
+#endif
@@ -0,0 +1,77 @@
+#include "dr_tft_term.h"
+#include "dr_tft_queue.h"
+
+static char term_text[TFT_TERM_ROWS][TFT_TERM_COLS]; //各屏幕行的文字，'\0'表示空白
+static uint8_t term_row = 0; //光标所在的屏幕行
+static uint8_t term_col = 0;
+static uint8_t term_wrapped = 0; //是否已经写满过一屏
+static uint16_t term_fg, term_bg;
+
+//放入绘图队列，队列满时只等待空出一个位置
+static void term_QueueChar(char ch, uint8_t row, uint8_t col) {
+    while (!etft_QueueChar(ch, col * 8, row * 16, term_fg, term_bg))
+        etft_QueueWait();
+}
+
+static void term_QueueClearRow(uint8_t row) {
+    while (!etft_QueueAreaSet(0, row * 16, TFT_YSIZE - 1, row * 16 + 15, term_bg))
+        etft_QueueWait();
+}
+
+//移到下一行，写满一屏后复用最旧的一行，只清除这一行
+static void term_NewLine() {
+    uint8_t col;
+    term_col = 0;
+    term_row++;
+    if (term_row >= TFT_TERM_ROWS) {
+        term_row = 0;
+        term_wrapped = 1;
+    }
+    if (term_wrapped) {
+        for (col = 0; col < TFT_TERM_COLS; col++)
+            term_text[term_row][col] = '\0';
+        term_QueueClearRow(term_row);
+    }
+}
+
+void etft_TermInit(uint16_t fRGB, uint16_t bRGB) {
+    uint8_t row, col;
+    term_fg = fRGB;
+    term_bg = bRGB;
+    term_row = 0;
+    term_col = 0;
+    term_wrapped = 0;
+    for (row = 0; row < TFT_TERM_ROWS; row++)
+        for (col = 0; col < TFT_TERM_COLS; col++)
+            term_text[row][col] = '\0';
+    while (!etft_QueueAreaSet(0, 0, TFT_YSIZE - 1, TFT_XSIZE - 1, bRGB))
+        etft_QueueWait();
+}
+
+void etft_TermPutChar(char ch) {
+    if (ch == '\r')
+        return;
+    if (ch == '\n') {
+        term_NewLine();
+        return;
+    }
+    if (term_col >= TFT_TERM_COLS)
+        term_NewLine();
+    term_text[term_row][term_col] = ch;
+    term_QueueChar(ch, term_row, term_col);
+    term_col++;
+}
+
+void etft_TermWrite(const char* str) {
+    while (*str != '\0')
+        etft_TermPutChar(*str++);
+}
+
+void etft_TermRedraw() {
+    uint8_t row, col;
+    for (row = 0; row < TFT_TERM_ROWS; row++) {
+        term_QueueClearRow(row);
+        for (col = 0; col < TFT_TERM_COLS && term_text[row][col] != '\0'; col++)
+            term_QueueChar(term_text[row][col], row, col);
+    }
+}
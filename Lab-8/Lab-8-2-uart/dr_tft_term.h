@@ -0,0 +1,26 @@
+#ifndef __DR_TFT_TERM_H_
+#define __DR_TFT_TERM_H_
+
+#include "dr_tft.h"
+#include <stdint.h>
+
+/* 基于绘图队列的文字终端 */
+/* 屏幕按8x16字符划分为TFT_TERM_ROWS行，写满后从顶行开始循环复用，新的一行只清除这16像素高的一条 */
+/* 同时保存各行文字，屏幕被其他绘图覆盖后可用etft_TermRedraw恢复 */
+
+#define TFT_TERM_COLS (TFT_YSIZE / 8)
+#define TFT_TERM_ROWS (TFT_XSIZE / 16)
+
+//清屏并清空文字缓冲，之后的文字使用fRGB、bRGB两种颜色
+void etft_TermInit(uint16_t fRGB, uint16_t bRGB);
+
+//输出一个字符，'\n'换行，'\r'忽略，行满自动换行
+void etft_TermPutChar(char ch);
+
+//输出一个字符串
+void etft_TermWrite(const char* str);
+
+//按文字缓冲重绘整个屏幕
+void etft_TermRedraw();
+
+#endif
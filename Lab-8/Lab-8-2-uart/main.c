@@ -8,12 +8,13 @@
 #define XT2_FREQ 4000000UL // Example: XT2 crystal at 4MHz
 
 #include "dr_tft.h"
+#include "dr_tft_queue.h"
+#include "dr_tft_term.h"
 #include <msp430f6638.h>
 #include <stdint.h>
 #include <stdio.h>
 
 unsigned char flag0 = 0, flag1 = 0;
-uint16_t sx = 10, sy = 20; //TFT屏显示位置
 uint8_t received_byte[] = { '0', '\0' };
 
 void TimerA_Init(void); //定时器TA初始化函数
@@ -25,37 +26,27 @@ void main(void) {
     init_clock();
     uart_init(BAUD_9600); //初始化UART1，波特率9600
     initTFT(); //初始化TFT屏幕
-    etft_AreaSet(0, 0, 319, 239, 0); //TFT清屏
     TimerA_Init(); //初始化定时器
     _EINT(); //开启中断
 
     uart_write_buffer((const uint8_t*)"UART Library Initialized. Echoing characters...\r\n", 47);
-    etft_DisplayString("Recv Data From UART (The data will be echoed back): ",
-                       sx,
-                       sy,
-                       65535,
-                       0); //TFT屏显示接收数据的标识
-    sy += 32;
+    etft_TermInit(65535, 0); //TFT清屏
+    etft_TermWrite("Recv Data From UART (The data will be echoed back):\n\n"); //TFT屏显示接收数据的标识
 
     while (1) {
+        etft_QueuePoll(); //DMA中断只结束一条绘图命令，下一条由主循环启动
         // Check if there's data available in the receive buffer
         if (uart_available() > 0) {
             // Read the byte from the buffer
             if (uart_read_byte(received_byte)) {
                 // Echo the byte back
                 uart_write_byte(received_byte[0]);
-                etft_DisplayString((const char *)received_byte, sx, sy, 65535, 0);
-                sx += 8;
-                if (sx + 10 > TFT_YSIZE) {
-                    sx = 10; // Reset x position if it exceeds screen width
-                    sy += 16; // Move to next line
-                }
+                // 终端经绘图队列显示，队列满时才等待，避免阻塞期间UART接收缓冲区溢出
+                // 写满一屏后从顶行开始循环复用，只清除新的一行；'\r'被忽略，CRLF换行也可正常显示
+                etft_TermPutChar(received_byte[0]);
 
-                if (received_byte[0] == '\n')
-                { // 记得串口工具使用LF换行符，不要使用CRLF换行符，windows环境尤其注意！
+                if (received_byte[0] == '\n') {
                     uart_write_buffer((const uint8_t*)"Line End Received.\n", 19);
-                    sx = 10;
-                    sy += 16;
                 }
             }
         }